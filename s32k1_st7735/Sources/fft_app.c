@@ -16,6 +16,8 @@
 
 #include "Cpu.h"
 #include "fft_app.h"
+#include "fft_tables.h"
+#include <float.h>
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
@@ -31,13 +33,122 @@
 #define FFT_SAMPLING_PERIOD_S                           (0.00005) /* LPIT set to 50us */
 #define FFT_SAMPLING_FREQUENCY_HZ                       (1.0 / FFT_SAMPLING_PERIOD_S)
 
+#if (FFT_ACQUISITION_BUFFERS < 2) || (FFT_ACQUISITION_BUFFERS > 3)
+#error "FFT_ACQUISITION_BUFFERS must be 2 or 3"
+#endif
+#if (FFT_OVERLAP_PERCENT != 0) && (FFT_OVERLAP_PERCENT != 50) && (FFT_OVERLAP_PERCENT != 75)
+#error "FFT_OVERLAP_PERCENT must be 0, 50 or 75"
+#endif
+#if defined(FFT_GOERTZEL) && defined(FFT_FIXED_POINT)
+#error "FFT_GOERTZEL cannot be combined with FFT_FIXED_POINT"
+#endif
+#if (FFT_BAND_LAYOUT > FFT_BANDS_CUSTOM)
+#error "FFT_BAND_LAYOUT must be FFT_BANDS_LINEAR, FFT_BANDS_OCTAVE, FFT_BANDS_THIRD_OCTAVE or FFT_BANDS_CUSTOM"
+#endif
+
+/* Samples in the acquisition ring and between the starts of two frames */
+#define FFT_RING_SIZE                                   (FFT_ACQUISITION_BUFFERS * FFT_SAMPLE_MAX)
+#define FFT_HOP_SAMPLES                                 ((FFT_SAMPLE_MAX * (100U - FFT_OVERLAP_PERCENT)) / 100U)
+
 /* The frequency response is half the size of the time domain data + 1 (Nyquist) */
 #define FFT_FREQUENCY_RESP_SIZE                         ((FFT_SAMPLE_MAX / 2) + 1)
 
+/* Complex values in the FFT scratch: the real input transform packs the
+ * samples in pairs and its split needs the Nyquist bin */
+#ifdef FFT_REAL_INPUT
+#define FFT_SCRATCH_SIZE                                FFT_FREQUENCY_RESP_SIZE
+#else
+#define FFT_SCRATCH_SIZE                                FFT_SAMPLE_MAX
+#endif
+
+/* Static RAM of the FFT buffers: DSP scratch (FFT_Arena), acquisition ring
+ * and the bin to band tables */
+#ifdef FFT_FIXED_POINT
+#define FFT_ARENA_BYTES                                 (FFT_SCRATCH_SIZE * 4U)
+#else
+#define FFT_ARENA_BYTES                                 (FFT_SCRATCH_SIZE * 8U)
+#endif
+#define FFT_RAM_BYTES                                   (FFT_ARENA_BYTES + (FFT_RING_SIZE * 2U) + (FFT_FREQUENCY_RESP_SIZE * 5U))
+
+#if !defined(FFT_GOERTZEL) && (FFT_RAM_BYTES > FFT_RAM_BUDGET_BYTES)
+#error "The FFT buffers need more than FFT_RAM_BUDGET_BYTES, tools/fft_tables.py prints the RAM of each configuration"
+#endif
+
 #define FFT_PI                                          (3.141592653)
 #define FFT_ADC_MAX                                     (4095U)
 #define FFT_ADC_REFERENCE                               (5.0)
 
+/* Single precision, FFT_ADC_REFERENCE alone would make the per sample
+ * conversion a double multiply, which the Cortex-M4 FPU does not have */
+#define FFT_VOLTS_PER_COUNT                             ((float)(FFT_ADC_REFERENCE / FFT_ADC_MAX))
+
+#if (FFT_TABLE_SIZE != FFT_SAMPLE_MAX)
+#error "fft_tables.c does not match FFT_SAMPLE_MAX, run tools/fft_tables.py -n FFT_SAMPLE_MAX"
+#endif
+
+#if ((FFT_WINDOWS & (1U << FFT_DEFAULT_WINDOW)) == 0)
+#error "fft_tables.c has no FFT_DEFAULT_WINDOW, add it to tools/fft_tables.py --windows"
+#endif
+
+/* The ADC midscale is removed before the window, so the DC offset does not
+ * use up the fixed point range or leak through the window sidelobes. What
+ * is left of it is in the first FFT_DC_BINS bins (the main lobe of the
+ * window), they are never part of a band */
+#define FFT_ADC_MIDSCALE                                (2048)
+#define FFT_ADC_TO_Q15_SHIFT                            (4U)
+#define FFT_DC_BINS                                     (2U)
+
+/* Peaks are searched in the bins FFT_DC_BINS to FFT_SAMPLE_MAX / 2 - 1,
+ * whatever the band layout, the first bin and Nyquist are only neighbours */
+#define FFT_PEAK_FIRST_BIN                              (FFT_DC_BINS - 1U)
+#define FFT_PEAK_SEARCH_BINS                            (FFT_FREQUENCY_RESP_SIZE - FFT_PEAK_FIRST_BIN)
+
+/* Band energies are accumulated in slots: 0 is below the first band,
+ * b + 1 is band b and FFT_FREQ_BANDS + 1 is above the last band */
+#define FFT_BAND_SLOTS                                  (FFT_FREQ_BANDS + 2U)
+
+/* 20 * log10(2), dB per octave of amplitude */
+#define FFT_DB_PER_LOG2                                 (6.0205999f)
+
+/* Added to bin powers before their log2 so silent bins stay finite, -120dB */
+#define FFT_PEAK_POWER_MIN                              (1e-12f)
+
+/* Seconds between the starts of two frames, log2(e) for exp() as exp2f() */
+#define FFT_HOP_S                                       ((float)(FFT_HOP_SAMPLES * FFT_SAMPLING_PERIOD_S))
+#define FFT_LOG2_E                                      (1.4426950f)
+
+/* Rows of the peak hold line above a bar */
+#define FFT_HOLD_ROWS                                   (2)
+
+#if (FFT_SMOOTH_RMS_FRAMES < 1) || (FFT_SMOOTH_RMS_FRAMES > 255)
+#error "FFT_SMOOTH_RMS_FRAMES must be 1 to 255"
+#endif
+#if (FFT_PEAK_MAX < 1) || (FFT_PEAK_INTERPOLATION > FFT_PEAK_GAUSSIAN)
+#error "FFT_PEAK_MAX must be at least 1 and FFT_PEAK_INTERPOLATION FFT_PEAK_PARABOLIC or FFT_PEAK_GAUSSIAN"
+#endif
+
+/* Largest Q15 component that a butterfly (a + w * b) cannot grow past
+ * 32767, the growth is at most 1 + sqrt(2) */
+#define FFT_Q15_BUTTERFLY_MAX                           (13572)
+
+/* The filter bank tracks the DC level of the samples with a one pole low
+ * pass (time constant 4096 samples, about 0.2s) and removes it, otherwise
+ * it would leak into the lowest bands */
+#define FFT_GOERTZEL_DC_RATE                            (1.0f / 4096.0f)
+
+/* Each band sums the power of two Hann windowed filters, a quarter of the
+ * band in from each edge, over blocks of 3 * sampling frequency / band width
+ * samples. Their bins are a third of the band apart, so the band edges are
+ * 3dB down and the next band up is in the sidelobes */
+#define FFT_GOERTZEL_FILTERS                            (2U)
+#define FFT_GOERTZEL_BLOCK_BANDS                        (3.0)
+
+/* Bars fill the 128 - 10 - 10 rows between the title and the labels, the
+ * top is FFT_BAR_FULL_SCALE_V */
+#define FFT_BAR_TOP                                     (10)
+#define FFT_BAR_HEIGHT                                  (108)
+#define FFT_BAR_FULL_SCALE_V                            (0.5f)
+
 #define TFT_FONT_1_WIDTH                                (6)
 #define TFT_FONT_1_HEIGHT                               (8)
 
@@ -46,37 +157,182 @@
 //////////////////////////////////////////////////////////////////////
 
 /**
- * As this variables are huge, they may collide with the default stack from Eclipse:
- *                 0x00000400                HEAP_SIZE = DEFINED (__heap_size__)?__heap_size__:0x400
- *                 0x00000400                STACK_SIZE = DEFINED (__stack_size__)?__stack_size__:0x400
- *
- * Modify this in the corresponding linker section (*.ld files).
+ * All the large buffers are static, so the worst case RAM of a configuration
+ * is the .bss shown by "Print size" after every build and nothing big is left
+ * on the stack (STACK_SIZE in the *.ld files). The build stops if they do not
+ * fit in FFT_RAM_BUDGET_BYTES, tools/fft_tables.py prints them per configuration.
  *
  * In order to get stack usage reports use these arguments in gcc:
  * -fstack-usage
+ * -fcallgraph-info=su (gcc 10 on, the call graph to add the frames up along
+ * the deepest path, main through the TFT text functions)
  *
  * Fix for S32K144 stack and bss allocation available here:
  * https://electrolinks.blogspot.com/2020/05/calcular-el-stack-en-s32-design-studio.html
  *
  */
 
-static uint16_t FFT_AudioSamples[FFT_SAMPLE_MAX];
-static float FFT_HammingWindow[FFT_SAMPLE_MAX];
-static float FFT_Frequency_Bands[FFT_FREQ_BANDS];
-static uint8_t FFT_elementsPerBand = 0;
+#ifdef FFT_GOERTZEL
+typedef struct FFT_Goertzel_Tag
+{
+    float coefficient[FFT_GOERTZEL_FILTERS];    /* 2 * cos(2 * pi * filter centre / sampling frequency) */
+    float s1[FFT_GOERTZEL_FILTERS];             /* Filter states, the last two outputs */
+    float s2[FFT_GOERTZEL_FILTERS];
+    float cosine;                               /* cos(2 * pi * n / length) of the Hann window */
+    float cosinePrevious;                       /* The same for n - 1 */
+    float cosineStep;                           /* 2 * cos(2 * pi / length) */
+    float energy;                               /* Sum of the block energies of the current hop */
+    float level;                                /* Mean block energy of the last hop that ended a block */
+    uint16_t length;                            /* Block length in samples */
+    uint16_t remaining;                         /* Samples left in the current block */
+    uint16_t blocks;                            /* Blocks in the current hop */
+    float scale;                                /* sqrt(mean block energy) to volts, main loop only */
+} FFT_Goertzel_T;
+
+static FFT_Goertzel_T FFT_Goertzel[FFT_FREQ_BANDS];
+
+/* Mean block energy per band of the last two hops, the interrupt writes
+ * one while the main loop reads the other */
+static float FFT_GoertzelEnergy[2][FFT_FREQ_BANDS];
+static float FFT_dcLevel = FFT_ADC_MIDSCALE;
+#else
+static uint16_t FFT_AudioSamples[FFT_RING_SIZE];
+
+/* Bin k adds FFT_BinWeight[k] of its power to slot FFT_BinSlot[k] and the
+ * rest to the next slot, only bins FFT_firstBin to FFT_lastBin touch a band */
+static uint8_t FFT_BinSlot[FFT_FREQUENCY_RESP_SIZE];
+static float FFT_BinWeight[FFT_FREQUENCY_RESP_SIZE];
+static uint16_t FFT_firstBin = 0;
+static uint16_t FFT_lastBin = 0;
+
+/* DSP scratch of FFT_GetFrequencyResponse, one frame at a time goes through:
+ *   copy       the frame out of the ring, converted and windowed
+ *   transform  the FFT in place
+ *   spectrum   the bin powers in place of the real parts (float) or of the
+ *              packed bins (Q15), read once to sum the bands
+ * Nothing in it is kept from one frame to the next */
+typedef struct FFT_Arena_Tag
+{
+#ifdef FFT_FIXED_POINT
+    uint32_t audio[FFT_SCRATCH_SIZE];   /* Packed Q15 samples, then the spectrum */
+#else
+    float real[FFT_SCRATCH_SIZE];       /* Samples, real parts, then bin powers */
+    float imag[FFT_SCRATCH_SIZE];       /* Samples (real input) or zeros, then imaginary parts */
+#endif
+} FFT_Arena_T;
+
+static FFT_Arena_T FFT_Arena;
+
+/* Peak search over the bins of one frame, see FFT_SearchPeak */
+typedef struct FFT_PeakSearch_Tag
+{
+    float before;                       /* Powers of the two previous bins */
+    float last;
+    float logSum;                       /* Sum of log2 of the powers, for the noise floor */
+    uint8_t found;                      /* Candidates, strongest first */
+    uint16_t bin[FFT_PEAK_MAX];         /* Local maxima */
+    float power[FFT_PEAK_MAX][3];       /* Powers of the bins before, at and after each */
+} FFT_PeakSearch_T;
+#endif
+static FFT_Peaks_T FFT_peaks;
+
+/* Temporal smoothing, see FFT_SmoothFrequencyResponse */
+static float FFT_smoothLevel[FFT_FREQ_BANDS];
+static float FFT_holdLevel[FFT_FREQ_BANDS];
+static float FFT_holdTime[FFT_FREQ_BANDS];    /* Seconds left before the hold falls */
+static uint32_t FFT_smoothedFrame = 0;        /* FFT_framesTaken of the last call */
+#if (FFT_SMOOTH_RMS_FRAMES > 1)
+static float FFT_rmsHistory[FFT_SMOOTH_RMS_FRAMES][FFT_FREQ_BANDS]; /* Squared levels */
+static uint8_t FFT_rmsNext = 0;
+static uint8_t FFT_rmsFrames = 0;
+#endif
+static uint8_t FFT_window = FFT_DEFAULT_WINDOW; /* FFT_WINDOW_* */
+static float FFT_Frequency_Bands[FFT_FREQ_BANDS]; /* Centre of each band in Hz */
+static float FFT_BandEdges[FFT_FREQ_BANDS + 1];   /* Lower edge of each band and upper edge of the last, Hz */
+
+/* Written by the ADC interrupt only */
+static volatile uint16_t FFT_hopCountdown = FFT_SAMPLE_MAX;
+static volatile uint32_t FFT_sampleCount = 0;
+static volatile uint32_t FFT_frameCount = 0;
+#ifndef FFT_GOERTZEL
+static volatile uint16_t FFT_currentSample = 0;
+static volatile uint16_t FFT_frameEnd = 0;
+static volatile uint32_t FFT_frameEndCount = 0;
+#endif
 
-static uint16_t FFT_currentSample = 0;
-static uint8_t FFT_bufferReady = 0;
+/* Written by the main loop only */
+static uint32_t FFT_framesTaken = 0;
+static uint32_t FFT_droppedFrames = 0;
+#ifndef FFT_GOERTZEL
+static uint32_t FFT_takenEndCount = 0;
+#endif
 
 //////////////////////////////////////////////////////////////////////
 /// Function prototypes
 //////////////////////////////////////////////////////////////////////
 
+#ifdef FFT_GOERTZEL
+/**
+ * Run the filter bank over one sample, from the ADC interrupt
+ * @param sample - 12 bits sample with DC offset
+ */
+static void FFT_GoertzelSample(uint16_t sample);
+
+/**
+ * Copy the band levels of the newest hop, counting the ones skipped as dropped
+ * @param freqResponsePerBand - a pointer to an array of FFT_FREQ_BANDS float variables
+ */
+static void FFT_GetFrequencyResponseGoertzel(float* freqResponsePerBand);
+
+/**
+ * Initialize the filter of each band from the band centres and widths
+ */
+static void FFT_Initialize_Goertzel(void);
+#else
+/**
+ * Take the newest complete frame, counting the ones skipped as dropped
+ * @return ring index of its first sample
+ */
+static uint32_t FFT_ClaimFrame(void);
+
+/**
+ * Check that the claimed frame was not overwritten while it was copied,
+ * otherwise count it as dropped
+ * @return 1 if the copy is intact, 0 if it must not be analysed
+ */
+static uint8_t FFT_ReleaseFrame(void);
+
+/**
+ * Get sample i of the frame starting at ring index start
+ */
+static inline uint16_t FFT_FrameSample(uint32_t start, uint32_t i)
+{
+    uint32_t index = start + i;
+
+    if (index >= FFT_RING_SIZE)
+    {
+        index -= FFT_RING_SIZE;
+    }
+
+    return FFT_AudioSamples[index];
+}
+
+/**
+ * Get the bit reversal swap table for a transform size
+ * @param n - number of points
+ * @param count - returns the number of index pairs
+ * @return the table or 0 when there is none for n
+ */
+static const uint16_t (*FFT_BitReverseSwaps(long n, uint32_t* count))[2];
+
+#ifndef FFT_FIXED_POINT
 /**
  * This computes an in-place complex-to-complex FFT
  * re and im are the real and imaginary arrays of 2^m points.
  * dir =  1 gives forward transform
  * dir = -1 gives reverse transform
+ * Single precision throughout, twiddles come from FFT_TwiddleTable so
+ * m can be at most FFT_TABLE_POWER_OF_TWO. Radix-2 or radix-4 (FFT_RADIX4).
  * @param dir
  * @param m
  * @param re
@@ -85,143 +341,614 @@ static uint8_t FFT_bufferReady = 0;
 static void FFT(int dir, long m, float* re, float* im);
 
 /**
- * Initialize a Hamming window array
+ * Put 2^m complex values in bit reversed order
+ * @param m
+ * @param re
+ * @param im
+ */
+static void FFT_BitReverse(long m, float* re, float* im);
+
+#ifdef FFT_REAL_INPUT
+/**
+ * This computes the spectrum of 2^m real samples with a 2^(m-1) point FFT
+ * On entry re[n] and im[n] hold the samples 2n and 2n+1 (n < 2^(m-1)),
+ * on exit re and im hold the bins 0 to 2^(m-1), so both need 2^(m-1)+1 elements.
+ * @param m
+ * @param re
+ * @param im
+ * @param power - if not 0 the last pass writes the single sided power (amplitude
+ *                squared) of each bin here instead of the spectrum, it may be re
+ */
+static void FFT_Real(long m, float* re, float* im, float* power);
+#else
+/**
+ * Power of count complex values in one pass, (re^2 + im^2) * scale
+ * @param re
+ * @param im
+ * @param power - may be re or im
+ * @param count
+ * @param scale
+ */
+static void FFT_PowerSpectrum(const float* re, const float* im, float* power, uint32_t count, float scale);
+#endif
+#endif
+
+#ifdef FFT_FIXED_POINT
+/**
+ * Fixed point version of FFT_GetFrequencyResponse
+ * @param start - ring index of the first sample of the claimed frame
+ * @param freqResponsePerBand - a pointer to an array of FFT_FREQ_BANDS float variables
+ * @return 1 if updated, 0 if the frame was overwritten while it was copied
+ */
+static uint8_t FFT_GetFrequencyResponseQ15(uint32_t start, float* freqResponsePerBand);
+
+/**
+ * This computes an in-place forward FFT of 2^m packed Q15 complex values,
+ * real part in bits 0-15 and imaginary part in bits 16-31
+ * Stages are scaled down by powers of two only when needed (block floating point).
+ * @param m
+ * @param data
+ * @param peak - returns the largest component magnitude of the result
+ * @return exponent, the result times 2^exponent is the unscaled transform
+ */
+static int8_t FFT_Q15(long m, uint32_t* data, int32_t* peak);
+
+#ifdef FFT_REAL_INPUT
+/**
+ * This computes the spectrum of 2^m real Q15 samples with a 2^(m-1) point FFT_Q15
+ * On entry data[n] holds the samples 2n (bits 0-15) and 2n+1 (bits 16-31),
+ * on exit data holds the bins 0 to 2^(m-1), so it needs 2^(m-1)+1 elements.
+ * @param m
+ * @param data
+ * @return exponent, the result times 2^exponent is the unscaled transform
+ */
+static int8_t FFT_RealQ15(long m, uint32_t* data);
+#endif
+
+#endif
+
+/**
+ * Add the power of a bin to the bands it overlaps
+ * @param energy - FFT_BAND_SLOTS sums, see FFT_BAND_SLOTS
+ * @param bin
+ * @param power - single sided power of the bin in volts^2
+ */
+static inline void FFT_AddBinPower(float* energy, uint32_t bin, float power)
+{
+    const uint8_t slot = FFT_BinSlot[bin];
+    const float lower = FFT_BinWeight[bin] * power;
+
+    energy[slot] += lower;
+    energy[slot + 1] += power - lower;
+}
+
+/**
+ * Convert the band energies to the amplitude in volts of a tone with the
+ * same power, correcting for the power lost to the window
+ * @param energy - FFT_BAND_SLOTS sums, see FFT_BAND_SLOTS
+ * @param freqResponsePerBand - a pointer to an array of FFT_FREQ_BANDS float variables
+ */
+static void FFT_GetBandLevels(const float* energy, float* freqResponsePerBand);
+
+/**
+ * Initialize the bin to band slot and weight tables from the band edges
+ */
+static void FFT_Initialize_Band_Tables(void);
+
+#ifdef FFT_FIXED_POINT
+/**
+ * Get coefficient n of a window from its half length table
+ * @param half - FFT_WindowTableQ15 row, the second half mirrors it
+ * @param n - 0 .. FFT_SAMPLE_MAX - 1
+ */
+static inline int32_t FFT_WindowCoefficientQ15(const int16_t* half, uint32_t n)
+{
+    return half[(n < (FFT_SAMPLE_MAX / 2)) ? n : (FFT_SAMPLE_MAX - 1 - n)];
+}
+#else
+/**
+ * Get coefficient n of a window from its half length table
+ * @param half - FFT_WindowTable row, the second half mirrors it
+ * @param n - 0 .. FFT_SAMPLE_MAX - 1
  */
-static void FFT_Initialize_Hamming(void);
+static inline float FFT_WindowCoefficient(const float* half, uint32_t n)
+{
+    return half[(n < (FFT_SAMPLE_MAX / 2)) ? n : (FFT_SAMPLE_MAX - 1 - n)];
+}
+#endif
+#endif /* !FFT_GOERTZEL */
 
 /**
- * Initialize a small array of bands showing the center frequency
- * for each one
+ * Initialize the edges and centre frequency of each band for FFT_BAND_LAYOUT
  */
 static void FFT_Initialize_Frequency_Bands(void);
 
+/**
+ * Get the height in rows of a bar on screen, linear or FFT_PLOT_DECIBELS
+ * @param level - band level in volts
+ * @return 0 to FFT_BAR_HEIGHT
+ */
+static int32_t FFT_BarHeight(float level);
+
+/**
+ * Draw rows low to high - 1 of a bar, counted from the bottom, green up to
+ * the top of the bar and white above
+ * @param x - left of the bar
+ * @param width - of the bar
+ * @param low - first row, clipped to the bar
+ * @param high - row after the last, clipped to the bar
+ * @param barHeight - top of the bar
+ */
+static void FFT_PlotBarRows(uint8_t x, uint8_t width, int32_t low, int32_t high, int32_t barHeight);
+
+/**
+ * Single precision square root, one VSQRT.F32 on the Cortex-M4 FPU instead
+ * of the libm call, which also checks for negative numbers to set errno
+ */
+static inline float FFT_SqrtF(float x)
+{
+#if defined(__GNUC__) && defined(__ARM_FP) && (__ARM_FP & 4)
+    float r;
+    __asm ("vsqrt.f32 %0, %1" : "=t" (r) : "t" (x));
+    return r;
+#else
+    return sqrtf(x);
+#endif
+}
+
+/**
+ * Approximate log2, within 0.005 for normal numbers
+ * @param x - greater than 0
+ */
+static inline float FFT_FastLog2(float x)
+{
+    union
+    {
+        float f;
+        uint32_t u;
+    } v;
+    float exponent;
+
+    v.f = x;
+    exponent = (float)(int32_t)((v.u >> 23) & 0xFFU) - 128.0f;
+
+    /* Mantissa in [1, 2) and a quadratic fit of 1 + log2 over it */
+    v.u = (v.u & 0x007FFFFFU) | 0x3F800000U;
+
+    return exponent + ((((-0.34484843f * v.f) + 2.02466578f) * v.f) - 0.67487759f);
+}
+
+#ifndef FFT_GOERTZEL
+/**
+ * Keep bin as a peak candidate, in order of power
+ * @param search - the search of the frame
+ * @param bin - a local maximum stronger than the weakest candidate
+ * @param next - power of bin + 1, the power of bin and bin - 1 are in search
+ */
+static void FFT_AddPeakCandidate(FFT_PeakSearch_T* search, uint32_t bin, float next);
+
+/**
+ * Start the peak search of a frame
+ */
+static inline void FFT_StartPeakSearch(FFT_PeakSearch_T* search)
+{
+    /* The first two bins cannot be local maxima, they have no lower neighbour */
+    search->before = FLT_MAX;
+    search->last = FLT_MAX;
+    search->logSum = 0.0f;
+    search->found = 0;
+}
+
+/**
+ * Check if the previous bin is a peak, called for every bin from
+ * FFT_PEAK_FIRST_BIN to Nyquist in order, in the same pass that adds the
+ * bins to the bands
+ * @param search - the search of the frame
+ * @param bin
+ * @param power - single sided power of the bin in volts^2
+ */
+static inline void FFT_SearchPeak(FFT_PeakSearch_T* search, uint32_t bin, float power)
+{
+    const float last = search->last;
+
+    search->logSum += FFT_FastLog2(power + FFT_PEAK_POWER_MIN);
+
+    /* bin - 1 is a local maximum and stronger than the weakest candidate */
+    if ((last > search->before) && (last >= power)
+        && ((search->found < FFT_PEAK_MAX) || (last > search->power[FFT_PEAK_MAX - 1][1])))
+    {
+        FFT_AddPeakCandidate(search, bin - 1, power);
+    }
+
+    search->before = last;
+    search->last = power;
+}
+
+/**
+ * Threshold the candidates against the noise floor and interpolate them
+ * into FFT_peaks
+ * @param search - the search of the frame
+ * @param bins - number of bins searched
+ */
+static void FFT_FinishPeakSearch(const FFT_PeakSearch_T* search, uint32_t bins);
+#endif
+
 //////////////////////////////////////////////////////////////////////
 /// Function definitions
 //////////////////////////////////////////////////////////////////////
 
 void FFT_Initialize(void)
 {
+    FFT_hopCountdown = FFT_SAMPLE_MAX;
+    FFT_sampleCount = 0;
+    FFT_frameCount = 0;
+    FFT_framesTaken = 0;
+    FFT_droppedFrames = 0;
+    FFT_window = FFT_DEFAULT_WINDOW;
+    (void)memset(&FFT_peaks, 0, sizeof(FFT_peaks));
+    (void)memset(&FFT_smoothLevel[0], 0, sizeof(FFT_smoothLevel));
+    (void)memset(&FFT_holdLevel[0], 0, sizeof(FFT_holdLevel));
+    (void)memset(&FFT_holdTime[0], 0, sizeof(FFT_holdTime));
+    FFT_smoothedFrame = 0;
+#if (FFT_SMOOTH_RMS_FRAMES > 1)
+    FFT_rmsNext = 0;
+    FFT_rmsFrames = 0;
+#endif
+
+#ifdef FFT_GOERTZEL
+    FFT_Initialize_Frequency_Bands();
+    FFT_Initialize_Goertzel();
+#else
     (void)memset(&FFT_AudioSamples[0], 0, sizeof(FFT_AudioSamples));
 
     FFT_currentSample = 0;
-    FFT_bufferReady = 0;
-    FFT_elementsPerBand = 0;
+    FFT_frameEnd = 0;
+    FFT_frameEndCount = 0;
+    FFT_takenEndCount = 0;
 
-    FFT_Initialize_Hamming();
     FFT_Initialize_Frequency_Bands();
+    FFT_Initialize_Band_Tables();
+#endif
 }
 
+#ifdef FFT_GOERTZEL
 void FFT_GetSample(uint16_t sample)
 {
-    if (0 == FFT_bufferReady)
-    {
-        FFT_AudioSamples[FFT_currentSample] = sample;
+    FFT_GoertzelSample(sample);
+}
+#else
+void FFT_GetSample(uint16_t sample)
+{
+    uint16_t current = FFT_currentSample;
 
-        FFT_currentSample++;
+    FFT_AudioSamples[current] = sample;
 
-        if (FFT_SAMPLE_MAX == FFT_currentSample)
-        {
-            FFT_bufferReady = 1;
-            FFT_currentSample = 0;
+    current++;
+    if (FFT_RING_SIZE == current)
+    {
+        current = 0;
+    }
+    FFT_currentSample = current;
+    FFT_sampleCount++;
 
-            /* Disable the ADC so that we do not get a new sample out of order */
-            INT_SYS_DisableIRQ(ADC0_IRQn);
-        }
+    /* A frame of FFT_SAMPLE_MAX samples ends here every FFT_HOP_SAMPLES,
+     * the main loop reads it from the ring while sampling goes on */
+    FFT_hopCountdown--;
+    if (0 == FFT_hopCountdown)
+    {
+        FFT_hopCountdown = FFT_HOP_SAMPLES;
+        FFT_frameEnd = current;
+        FFT_frameEndCount = FFT_sampleCount;
+        FFT_frameCount++;
     }
 }
+#endif
 
 void FFT_SetBufferAvailable(void)
 {
-    /* Critical section */
-    INT_SYS_DisableIRQ(ADC0_IRQn);
-    FFT_bufferReady = 0;
-    INT_SYS_EnableIRQ(ADC0_IRQn);
+    const uint32_t count = FFT_frameCount;
+
+    /* The frames ready until now are never analysed */
+    FFT_droppedFrames += count - FFT_framesTaken;
+    FFT_framesTaken = count;
 }
 
 uint8_t FFT_GetBufferReady(void)
 {
-    return FFT_bufferReady;
+    return (FFT_frameCount != FFT_framesTaken) ? 1 : 0;
+}
+
+uint32_t FFT_GetDroppedFrames(void)
+{
+    return FFT_droppedFrames;
 }
 
-void FFT_GetFrequencyResponse(float* freqResponsePerBand)
+#ifndef FFT_GOERTZEL
+static uint32_t FFT_ClaimFrame(void)
 {
-    if (1 == FFT_bufferReady)
+    uint32_t count;
+    uint32_t end;
+
+    /* The interrupt updates the frame variables together, read them again
+     * if a frame ended in between */
+    do
+    {
+        count = FFT_frameCount;
+        end = FFT_frameEnd;
+        FFT_takenEndCount = FFT_frameEndCount;
+    } while (count != FFT_frameCount);
+
+    FFT_droppedFrames += count - FFT_framesTaken - 1;
+    FFT_framesTaken = count;
+
+    return (end >= FFT_SAMPLE_MAX) ? (end - FFT_SAMPLE_MAX) : (end + FFT_RING_SIZE - FFT_SAMPLE_MAX);
+}
+
+static uint8_t FFT_ReleaseFrame(void)
+{
+    /* The oldest sample of the frame is overwritten once the ring has
+     * moved on by more than the other buffers, the copy is then a mix of
+     * two frames */
+    if ((FFT_sampleCount - FFT_takenEndCount) > (FFT_RING_SIZE - FFT_SAMPLE_MAX))
+    {
+        FFT_droppedFrames++;
+        return 0;
+    }
+
+    return 1;
+}
+#endif
+
+uint8_t FFT_GetFrequencyResponse(float* freqResponsePerBand)
+{
+    if (FFT_GetBufferReady())
     {
-        float audioReal[FFT_SAMPLE_MAX];
-        float audioImag[FFT_SAMPLE_MAX];
-        float freqResp[FFT_FREQUENCY_RESP_SIZE];
+#ifdef FFT_GOERTZEL
+        FFT_GetFrequencyResponseGoertzel(freqResponsePerBand);
+        return 1;
+#else
+        const uint32_t start = FFT_ClaimFrame();
+
+#ifdef FFT_FIXED_POINT
+        return FFT_GetFrequencyResponseQ15(start, freqResponsePerBand);
+#else
+#ifdef FFT_REAL_INPUT
+        /* Even samples in audioReal and odd samples in audioImag, the spectrum
+         * comes back in the same arrays and the powers replace audioReal */
+        float* audioReal = &FFT_Arena.real[0];
+        float* audioImag = &FFT_Arena.imag[0];
+        float* power = &audioReal[0];
+        const float* window = &FFT_WindowTable[FFT_WindowRow[FFT_window]][0];
+
+        /* Copy samples as fast as possible */
+        for(uint32_t i = 0; i < (FFT_SAMPLE_MAX / 2); i++)
+        {
+            audioReal[i] = (float)FFT_FrameSample(start, 2 * i);
+            audioImag[i] = (float)FFT_FrameSample(start, (2 * i) + 1);
+        }
+
+        /* The frame is no longer needed in the ring */
+        if (0 == FFT_ReleaseFrame())
+        {
+            return 0;
+        }
+
+        /* Convert samples to voltages around midscale */
+        for(uint32_t i = 0; i < (FFT_SAMPLE_MAX / 2); i++)
+        {
+            audioReal[i] = (audioReal[i] - FFT_ADC_MIDSCALE) * FFT_VOLTS_PER_COUNT;
+            audioImag[i] = (audioImag[i] - FFT_ADC_MIDSCALE) * FFT_VOLTS_PER_COUNT;
+
+            /* Apply window */
+            audioReal[i] *= FFT_WindowCoefficient(window, 2 * i);
+            audioImag[i] *= FFT_WindowCoefficient(window, (2 * i) + 1);
+        }
+
+        /* Calculate FFT and the powers in the same pass as the split */
+        FFT_Real(FFT_POWER_OF_TWO, &audioReal[0], &audioImag[0], power);
+#else
+        /* The powers replace audioReal */
+        float* audioReal = &FFT_Arena.real[0];
+        float* audioImag = &FFT_Arena.imag[0];
+        float* power = &audioReal[0];
+        const float* window = &FFT_WindowTable[FFT_WindowRow[FFT_window]][0];
 
         /* Copy samples as fast as possible */
         for(uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
         {
-            audioReal[i] = (float)FFT_AudioSamples[i];
+            audioReal[i] = (float)FFT_FrameSample(start, i);
         }
 
-        /* At this point the ADC sampling can be restarted as FFT_AudioSamples
-         * is no longer needed. */
-        FFT_SetBufferAvailable();
-        INT_SYS_EnableIRQ(ADC0_IRQn);
+        /* The frame is no longer needed in the ring */
+        if (0 == FFT_ReleaseFrame())
+        {
+            return 0;
+        }
 
-        (void)memset(&audioImag[0], 0, sizeof(audioImag));
-        (void)memset(&freqResp[0], 0, sizeof(freqResp));
+        (void)memset(&audioImag[0], 0, sizeof(FFT_Arena.imag));
 
-        /* Convert samples to voltages */
+        /* Convert samples to voltages around midscale */
         for(uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
         {
-            audioReal[i] = (audioReal[i] / FFT_ADC_MAX) * FFT_ADC_REFERENCE;
+            audioReal[i] = (audioReal[i] - FFT_ADC_MIDSCALE) * FFT_VOLTS_PER_COUNT;
 
-            /* Apply Hamming window */
-            audioReal[i] *= FFT_HammingWindow[i];
+            /* Apply window */
+            audioReal[i] *= FFT_WindowCoefficient(window, i);
         }
 
         /* Calculate FFT */
         FFT(1, FFT_POWER_OF_TWO, &audioReal[0], &audioImag[0]);
 
-        for (uint32_t i = 0; i < FFT_FREQUENCY_RESP_SIZE; ++i)
+        /* Single sided power in one pass, (2 * |X| / N)^2, but DC and
+         * Nyquist are not doubled */
+        FFT_PowerSpectrum(&audioReal[0], &audioImag[0], power, FFT_FREQUENCY_RESP_SIZE,
+                          4.0f / ((float)FFT_SAMPLE_MAX * FFT_SAMPLE_MAX));
+        power[0] *= 0.25f;
+        power[FFT_FREQUENCY_RESP_SIZE - 1] *= 0.25f;
+#endif
+
+        /* Accumulate the power of the bins per band and find the peaks
+         * over the whole spectrum */
         {
-            freqResp[i] = sqrt((audioReal[i] * audioReal[i]) + (audioImag[i] * audioImag[i]));
-            freqResp[i] /= FFT_SAMPLE_MAX;
+            float energy[FFT_BAND_SLOTS] = {0};
+            FFT_PeakSearch_T search;
+
+            FFT_StartPeakSearch(&search);
+            for (uint32_t bin = FFT_PEAK_FIRST_BIN; bin < FFT_FREQUENCY_RESP_SIZE; bin++)
+            {
+                if ((bin >= FFT_firstBin) && (bin <= FFT_lastBin))
+                {
+                    FFT_AddBinPower(energy, bin, power[bin]);
+                }
+                FFT_SearchPeak(&search, bin, power[bin]);
+            }
+
+            FFT_GetBandLevels(energy, freqResponsePerBand);
+            FFT_FinishPeakSearch(&search, FFT_PEAK_SEARCH_BINS);
         }
 
-        for (uint32_t i = 1; i < (FFT_FREQUENCY_RESP_SIZE - 1); ++i)
+        return 1;
+#endif
+#endif
+    }
+
+    return 0;
+}
+
+void FFT_SmoothFrequencyResponse(float* freqResponsePerBand)
+{
+    /* Time since the last call, from the frames analysed and dropped in
+     * between, and the exponential decays over it */
+    const float seconds = (float)(FFT_framesTaken - FFT_smoothedFrame) * FFT_HOP_S;
+#if (FFT_SMOOTH_ATTACK_MS > 0)
+    const float attack = exp2f((-FFT_LOG2_E * 1000.0f / FFT_SMOOTH_ATTACK_MS) * seconds);
+#else
+    const float attack = 0.0f;
+#endif
+#if (FFT_SMOOTH_RELEASE_MS > 0)
+    const float release = exp2f((-FFT_LOG2_E * 1000.0f / FFT_SMOOTH_RELEASE_MS) * seconds);
+#else
+    const float release = 0.0f;
+#endif
+#if (FFT_HOLD_MS > 0)
+    const float fall = exp2f((-FFT_HOLD_FALL_DB_PER_S / FFT_DB_PER_LOG2) * seconds);
+#endif
+
+    FFT_smoothedFrame = FFT_framesTaken;
+
+#if (FFT_SMOOTH_RMS_FRAMES > 1)
+    /* RMS of the last FFT_SMOOTH_RMS_FRAMES frames, summed again every time
+     * so rounding errors do not build up */
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        FFT_rmsHistory[FFT_rmsNext][currentBand] = freqResponsePerBand[currentBand] * freqResponsePerBand[currentBand];
+    }
+
+    FFT_rmsNext = (FFT_rmsNext + 1U) % FFT_SMOOTH_RMS_FRAMES;
+    if (FFT_rmsFrames < FFT_SMOOTH_RMS_FRAMES)
+    {
+        FFT_rmsFrames++;
+    }
+
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        float sum = 0.0f;
+
+        for (uint32_t frame = 0; frame < FFT_rmsFrames; frame++)
         {
-            freqResp[i] *= 2;
+            sum += FFT_rmsHistory[frame][currentBand];
         }
 
-        /* Accumulate various elements per band */
-        for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
-        {
-            freqResponsePerBand[currentBand] = 0;
+        freqResponsePerBand[currentBand] = FFT_SqrtF(sum / FFT_rmsFrames);
+    }
+#endif
+
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        const float level = freqResponsePerBand[currentBand];
+        const float coefficient = (level > FFT_smoothLevel[currentBand]) ? attack : release;
+        const float smooth = level + (coefficient * (FFT_smoothLevel[currentBand] - level));
 
-            for (uint32_t currentElement = 0; currentElement < FFT_elementsPerBand; currentElement++)
+        FFT_smoothLevel[currentBand] = smooth;
+        freqResponsePerBand[currentBand] = smooth;
+
+#if (FFT_HOLD_MS > 0)
+        /* Hold the highest level, then let it fall but not below the bar */
+        if (smooth >= FFT_holdLevel[currentBand])
+        {
+            FFT_holdLevel[currentBand] = smooth;
+            FFT_holdTime[currentBand] = FFT_HOLD_MS / 1000.0f;
+        }
+        else if (FFT_holdTime[currentBand] > 0.0f)
+        {
+            FFT_holdTime[currentBand] -= seconds;
+        }
+        else
+        {
+            FFT_holdLevel[currentBand] *= fall;
+            if (FFT_holdLevel[currentBand] < smooth)
             {
-                freqResponsePerBand[currentBand] +=
-                    freqResp[currentElement + (currentBand * FFT_elementsPerBand)];
+                FFT_holdLevel[currentBand] = smooth;
             }
         }
+#endif
     }
 }
 
 void FFT_PlotFrequencyResponse(float* freqResponsePerBand)
 {
     static uint8_t initializedScreen = 0;
+    static int32_t shownBar[FFT_FREQ_BANDS];   /* Heights on screen, -1 before the first frame */
+    static int32_t shownHold[FFT_FREQ_BANDS];
+#ifdef FFT_PLOT_PEAK
+    static TFT_ST7735_NumField_T peakField;
+#endif
 
     if (0 == initializedScreen)
     {
         uint8_t x = 0;
         uint8_t y = TFT_ST7735_height() - TFT_FONT_1_HEIGHT;
-        char str[4] = {0, '.', 0, 0};
+        char str[4];
 
         TFT_ST7735_setTextColor(ST7735_YELLOW);
 
         TFT_ST7735_fillRect(x, 0, TFT_ST7735_width(), 10, ST7735_BLACK);
+#ifdef FFT_PLOT_PEAK
+        /* Strongest peak as "xxxxx.x Hz" in place of the title */
+        TFT_ST7735_setTextColor_bgcolor(ST7735_YELLOW, ST7735_BLACK);
+        TFT_ST7735_initNumField(&peakField, TFT_ST7735_width() / 2, 0, 7, 1, 1, TR_DATUM);
+        TFT_ST7735_drawString(" Hz", TFT_ST7735_width() / 2, 0, 1);
+#else
         TFT_ST7735_drawCentreString("MigSantiago.com", TFT_ST7735_width() / 2, 0, 1);
+#endif
         TFT_ST7735_fillRect(x, y - 1, TFT_ST7735_width(), 10, ST7735_BLACK);
 
         for (uint8_t i = 0; i < FFT_FREQ_BANDS; i++)
         {
-            str[0] = '0' + (int)(FFT_Frequency_Bands[i] / 1000.0);
-            str[2] = '0' + ((int)(FFT_Frequency_Bands[i] / 100.0)) % 10;
+            /* Centre frequency in 3 characters: "63", "500", "2k5", "10k" */
+            uint32_t hz = (uint32_t)(FFT_Frequency_Bands[i] + 0.5f);
+
+            (void)memset(str, ' ', sizeof(str));
+            if (hz < 1000)
+            {
+                str[0] = (hz >= 100) ? ('0' + (hz / 100)) : ' ';
+                str[1] = (hz >= 10) ? ('0' + ((hz / 10) % 10)) : ' ';
+                str[2] = '0' + (hz % 10);
+            }
+            else if (hz < 9950)
+            {
+                hz = (hz + 50) / 100;
+                str[0] = '0' + (hz / 10);
+                str[1] = 'k';
+                str[2] = ((hz % 10) != 0) ? ('0' + (hz % 10)) : ' ';
+            }
+            else
+            {
+                hz = (hz + 500) / 1000;
+                str[0] = '0' + ((hz / 10) % 10);
+                str[1] = '0' + (hz % 10);
+                str[2] = 'k';
+            }
 
             TFT_ST7735_drawChar(x, y, str[0], ST7735_YELLOW, ST7735_BLACK, 1);
             TFT_ST7735_drawChar(x + 5, y, str[1], ST7735_YELLOW, ST7735_BLACK, 1);
@@ -229,98 +956,504 @@ void FFT_PlotFrequencyResponse(float* freqResponsePerBand)
 
             /* Move to the right */
             x += TFT_ST7735_width() / FFT_FREQ_BANDS;
+
+            shownBar[i] = -1;
+            shownHold[i] = 0;
         }
 
         initializedScreen = 1;
     }
 
+#ifdef FFT_PLOT_PEAK
     {
-        /* Bar height = 128 - 10 - 10 */
-        const int32_t barTotalHeight = 108;
-        const float maximumVoltage = 0.5;
-        int32_t barHeight;
+        const FFT_Peaks_T* peaks = FFT_GetPeaks();
 
-        /* Workaround, remove DC offset */
-        freqResponsePerBand[0] -= 1.983;
+        /* Tenths of Hz, 0 without a peak */
+        (void)TFT_ST7735_drawNumField(&peakField,
+                                      (peaks->count > 0) ? (int32_t)((peaks->peak[0].frequency * 10.0f) + 0.5f) : 0);
+    }
+#endif
 
-        /* Draw bars */
-        uint8_t x = 0;
-        uint8_t y = 10;
+    {
+        const uint8_t barWidth = (TFT_ST7735_width() / FFT_FREQ_BANDS) - 15; /* shorter is faster to draw */
+        uint8_t x = 6;
+
+        /* Draw bars, only the rows that changed since the last frame */
         for (uint8_t i = 0; i < FFT_FREQ_BANDS; i++)
         {
-            /* barHeight can exceed the maximumVoltage, so make it int32_t */
-            barHeight = (freqResponsePerBand[i] / maximumVoltage) * barTotalHeight;
+            const int32_t barHeight = FFT_BarHeight(freqResponsePerBand[i]);
+#if (FFT_HOLD_MS > 0)
+            const int32_t holdHeight = FFT_BarHeight(FFT_holdLevel[i]);
+#else
+            const int32_t holdHeight = 0;
+#endif
 
-            if (barHeight > barTotalHeight)
-            {
-                barHeight = barTotalHeight;
-            }
-            else if (barHeight < 0)
+            if ((barHeight != shownBar[i]) || (holdHeight != shownHold[i]))
             {
-                barHeight = 0;
-            }
+                if (shownBar[i] < 0)
+                {
+                    FFT_PlotBarRows(x, barWidth, 0, FFT_BAR_HEIGHT, barHeight);
+                }
+                else if (barHeight > shownBar[i])
+                {
+                    FFT_PlotBarRows(x, barWidth, shownBar[i], barHeight, barHeight);
+                }
+                else
+                {
+                    FFT_PlotBarRows(x, barWidth, barHeight, shownBar[i], barHeight);
+                }
+
+                /* Clear the old hold line and draw the new one above the bar */
+                if (shownHold[i] > 0)
+                {
+                    FFT_PlotBarRows(x, barWidth, shownHold[i] - FFT_HOLD_ROWS, shownHold[i], barHeight);
+                }
+                if (holdHeight > barHeight)
+                {
+                    const int32_t low = ((holdHeight - FFT_HOLD_ROWS) > barHeight) ? (holdHeight - FFT_HOLD_ROWS) : barHeight;
 
-            /* Draw Height */
-            TFT_ST7735_fillRect(
-                x + 6,
-                y + (barTotalHeight - barHeight),
-                (TFT_ST7735_width() / FFT_FREQ_BANDS) - 15, /* shorter is faster to draw */
-                barHeight,
-                ST7735_GREEN);
-
-            /* Draw empty space */
-            TFT_ST7735_fillRect(
-                x + 6,
-                y,
-                (TFT_ST7735_width() / FFT_FREQ_BANDS) - 15, /* shorter is faster to draw */
-                barTotalHeight - barHeight,
-                ST7735_WHITE);
+                    TFT_ST7735_fillRect(x, FFT_BAR_TOP + (FFT_BAR_HEIGHT - holdHeight), barWidth, holdHeight - low, ST7735_RED);
+                }
+
+                shownBar[i] = barHeight;
+                shownHold[i] = holdHeight;
+            }
 
             x += TFT_ST7735_width() / FFT_FREQ_BANDS;
         }
     }
 }
 
-static void FFT(int dir, long m, float* re, float* im)
+static int32_t FFT_BarHeight(float level)
 {
-    long n,i,i1,j,k,i2,l,l1,l2;
-    double c1,c2,tx,ty,t1,t2,u1,u2,z;
+    int32_t barHeight;
 
-    /* Calculate the number of points */
-    n = 1;
-    for (i=0;i<m;i++)
-        n *= 2;
+#ifdef FFT_PLOT_DECIBELS
+    /* FFT_BAR_FULL_SCALE_V at the top, FFT_PLOT_DECIBEL_RANGE below it at the bottom */
+    barHeight = ((FFT_GetDecibels(level / FFT_BAR_FULL_SCALE_V) + FFT_PLOT_DECIBEL_RANGE)
+                 / FFT_PLOT_DECIBEL_RANGE) * FFT_BAR_HEIGHT;
+#else
+    /* barHeight can exceed FFT_BAR_FULL_SCALE_V, so make it int32_t */
+    barHeight = (level / FFT_BAR_FULL_SCALE_V) * FFT_BAR_HEIGHT;
+#endif
 
-    /* Do the bit reversal */
-    i2 = n >> 1;
-    j = 0;
-    for (i=0;i<n-1;i++) {
-        if (i < j) {
-            tx = re[i];
-            ty = im[i];
-            re[i] = re[j];
-            im[i] = im[j];
-            re[j] = tx;
-            im[j] = ty;
-        }
-        k = i2;
-        while (k <= j) {
+    if (barHeight > FFT_BAR_HEIGHT)
+    {
+        barHeight = FFT_BAR_HEIGHT;
+    }
+    else if (barHeight < 0)
+    {
+        barHeight = 0;
+    }
+
+    return barHeight;
+}
+
+static void FFT_PlotBarRows(uint8_t x, uint8_t width, int32_t low, int32_t high, int32_t barHeight)
+{
+    int32_t top;
+
+    if (low < 0)
+    {
+        low = 0;
+    }
+    if (high > FFT_BAR_HEIGHT)
+    {
+        high = FFT_BAR_HEIGHT;
+    }
+
+    /* Rows up to the top of the bar are green, the ones above white */
+    top = (barHeight < low) ? low : ((barHeight > high) ? high : barHeight);
+
+    if (top > low)
+    {
+        TFT_ST7735_fillRect(x, FFT_BAR_TOP + (FFT_BAR_HEIGHT - top), width, top - low, ST7735_GREEN);
+    }
+    if (high > top)
+    {
+        TFT_ST7735_fillRect(x, FFT_BAR_TOP + (FFT_BAR_HEIGHT - high), width, high - top, ST7735_WHITE);
+    }
+}
+
+uint8_t FFT_SetWindow(uint8_t window)
+{
+    if ((window >= FFT_WINDOW_COUNT) || (0 == (FFT_WINDOWS & (1U << window))))
+    {
+        return 0;
+    }
+
+    FFT_window = window;
+
+    return 1;
+}
+
+const FFT_WindowGain_T* FFT_GetWindowGain(void)
+{
+    return &FFT_WindowGains[FFT_window];
+}
+
+const FFT_Peaks_T* FFT_GetPeaks(void)
+{
+    return &FFT_peaks;
+}
+
+float FFT_GetDecibels(float level)
+{
+    /* 20 * log10(level) = 20 * log10(2) * log2(level), silence is clamped */
+    if (level < 1e-9f)
+    {
+        level = 1e-9f;
+    }
+
+    return FFT_DB_PER_LOG2 * FFT_FastLog2(level);
+}
+
+#ifdef FFT_GOERTZEL
+//////////////////////////////////////////////////////////////////////
+/// Goertzel filter bank
+//////////////////////////////////////////////////////////////////////
+
+static void FFT_GoertzelSample(uint16_t sample)
+{
+    const float x = (float)sample - FFT_dcLevel;
+
+    FFT_dcLevel += x * FFT_GOERTZEL_DC_RATE;
+
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        FFT_Goertzel_T* g = &FFT_Goertzel[currentBand];
+        /* Periodic Hann window, the cosine by a recurrence restarted every block */
+        const float windowed = x * (0.5f - (0.5f * g->cosine));
+        const float cosine = (g->cosineStep * g->cosine) - g->cosinePrevious;
+
+        g->cosinePrevious = g->cosine;
+        g->cosine = cosine;
+
+        for (uint32_t filter = 0; filter < FFT_GOERTZEL_FILTERS; filter++)
+        {
+            const float s0 = windowed + (g->coefficient[filter] * g->s1[filter]) - g->s2[filter];
+
+            g->s2[filter] = g->s1[filter];
+            g->s1[filter] = s0;
+        }
+
+        /* Energy of the block, the squared magnitudes of its DFT at the filter centres */
+        g->remaining--;
+        if (0 == g->remaining)
+        {
+            for (uint32_t filter = 0; filter < FFT_GOERTZEL_FILTERS; filter++)
+            {
+                g->energy += (g->s1[filter] * g->s1[filter]) + (g->s2[filter] * g->s2[filter])
+                           - (g->coefficient[filter] * g->s1[filter] * g->s2[filter]);
+                g->s1[filter] = 0;
+                g->s2[filter] = 0;
+            }
+            g->blocks++;
+            g->cosine = 1.0f;
+            g->cosinePrevious = 0.5f * g->cosineStep;
+            g->remaining = g->length;
+        }
+    }
+
+    FFT_sampleCount++;
+
+    /* Publish the mean block energies every FFT_HOP_SAMPLES, into the
+     * buffer the main loop is not reading */
+    FFT_hopCountdown--;
+    if (0 == FFT_hopCountdown)
+    {
+        float* energy = &FFT_GoertzelEnergy[(FFT_frameCount + 1U) & 1U][0];
+
+        FFT_hopCountdown = FFT_HOP_SAMPLES;
+
+        for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+        {
+            FFT_Goertzel_T* g = &FFT_Goertzel[currentBand];
+
+            /* A block longer than the hop keeps the level of the last one */
+            if (g->blocks > 0)
+            {
+                g->level = g->energy / g->blocks;
+            }
+            energy[currentBand] = g->level;
+            g->energy = 0;
+            g->blocks = 0;
+        }
+
+        FFT_frameCount++;
+    }
+}
+
+static void FFT_GetFrequencyResponseGoertzel(float* freqResponsePerBand)
+{
+    uint32_t count;
+
+    /* The interrupt only writes this buffer again two hops later, copy it
+     * again if that happened in between */
+    do
+    {
+        const float* energy;
+
+        count = FFT_frameCount;
+        energy = &FFT_GoertzelEnergy[count & 1U][0];
+
+        for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+        {
+            freqResponsePerBand[currentBand] = energy[currentBand];
+        }
+    } while ((FFT_frameCount - count) > 1U);
+
+    FFT_droppedFrames += count - FFT_framesTaken - 1;
+    FFT_framesTaken = count;
+
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        freqResponsePerBand[currentBand] = FFT_SqrtF(freqResponsePerBand[currentBand]) * FFT_Goertzel[currentBand].scale;
+    }
+}
+
+static void FFT_Initialize_Goertzel(void)
+{
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        FFT_Goertzel_T* g = &FFT_Goertzel[currentBand];
+        const float bandWidthHz = FFT_BandEdges[currentBand + 1] - FFT_BandEdges[currentBand];
+        uint32_t length = (uint32_t)(((FFT_GOERTZEL_BLOCK_BANDS * FFT_SAMPLING_FREQUENCY_HZ) / bandWidthHz) + 0.5);
+        double bins;
+        double hann;
+
+        /* No longer than a frame, so the levels follow the signal as fast as the FFT */
+        if (length < 4)
+        {
+            length = 4;
+        }
+        else if (length > FFT_SAMPLE_MAX)
+        {
+            length = FFT_SAMPLE_MAX;
+        }
+
+        /* The response is symmetric in Hz, so the filters sit around the
+         * middle of the band rather than its nominal (geometric) centre */
+        for (uint32_t filter = 0; filter < FFT_GOERTZEL_FILTERS; filter++)
+        {
+            const float centreHz = FFT_BandEdges[currentBand]
+                                 + ((bandWidthHz * ((2 * filter) + 1)) / (2 * FFT_GOERTZEL_FILTERS));
+
+            g->coefficient[filter] = 2.0 * cos((2.0 * FFT_PI * centreHz) / FFT_SAMPLING_FREQUENCY_HZ);
+            g->s1[filter] = 0;
+            g->s2[filter] = 0;
+        }
+
+        g->cosineStep = 2.0 * cos((2.0 * FFT_PI) / length);
+        g->cosine = 1.0f;
+        g->cosinePrevious = 0.5f * g->cosineStep;
+        g->energy = 0;
+        g->level = 0;
+        g->length = length;
+        g->remaining = length;
+        g->blocks = 0;
+
+        /* A tone of amplitude A at a filter centre gives a block magnitude of
+         * A * length / 4 (Hann coherent gain 0.5), at the middle of the band
+         * each filter is a quarter of the band off and reads it times the
+         * Hann response there: calibrate so the middle reads A, the same
+         * single sided amplitude as the FFT */
+        bins = ((bandWidthHz / (2 * FFT_GOERTZEL_FILTERS)) * length) / FFT_SAMPLING_FREQUENCY_HZ;
+        hann = sin(FFT_PI * bins) / ((FFT_PI * bins) * (1.0 - (bins * bins)));
+        g->scale = (4.0f / (length * hann * sqrt(FFT_GOERTZEL_FILTERS))) * FFT_VOLTS_PER_COUNT;
+    }
+
+    (void)memset(&FFT_GoertzelEnergy[0][0], 0, sizeof(FFT_GoertzelEnergy));
+    FFT_dcLevel = FFT_ADC_MIDSCALE;
+}
+
+#else
+static const uint16_t (*FFT_BitReverseSwaps(long n, uint32_t* count))[2]
+{
+    if (n == (long)FFT_TABLE_SIZE)
+    {
+        *count = FFT_BIT_REVERSE_SWAPS;
+        return FFT_BitReverseTable;
+    }
+    if (n == (long)(FFT_TABLE_SIZE / 2))
+    {
+        *count = FFT_BIT_REVERSE_HALF_SWAPS;
+        return FFT_BitReverseTableHalf;
+    }
+
+    *count = 0;
+    return 0;
+}
+
+#ifndef FFT_FIXED_POINT
+static void FFT_BitReverse(long m, float* re, float* im)
+{
+    long n,i,j,k,i2;
+    float tx,ty;
+    uint32_t count;
+    const uint16_t (*swaps)[2];
+
+    n = 1L << m;
+    swaps = FFT_BitReverseSwaps(n, &count);
+
+    if (swaps) {
+        /* Table in flash for the sizes in use */
+        for (uint32_t s = 0; s < count; s++) {
+            i = swaps[s][0];
+            j = swaps[s][1];
+            tx = re[i];
+            ty = im[i];
+            re[i] = re[j];
+            im[i] = im[j];
+            re[j] = tx;
+            im[j] = ty;
+        }
+        return;
+    }
+
+    i2 = n >> 1;
+    j = 0;
+    for (i=0;i<n-1;i++) {
+        if (i < j) {
+            tx = re[i];
+            ty = im[i];
+            re[i] = re[j];
+            im[i] = im[j];
+            re[j] = tx;
+            im[j] = ty;
+        }
+        k = i2;
+        while (k <= j) {
             j -= k;
             k >>= 1;
         }
         j += k;
     }
+}
+
+#ifdef FFT_RADIX4
+static void FFT(int dir, long m, float* re, float* im)
+{
+    long n,i,i1,i2,i3,j,l,l4,step,k;
+    float w1r,w1i,w2r,w2i,w3r,w3i;
+    float t1r,t1i,t2r,t2i,t3r,t3i,s0r,s0i,d0r,d0i,s1r,s1i,d1r,d1i;
+
+    if (m > (long)FFT_TABLE_POWER_OF_TWO)
+        return;
+
+    /* Calculate the number of points */
+    n = 1L << m;
+
+    FFT_BitReverse(m, re, im);
+
+    /* Odd powers of two start with a radix-2 stage, all its twiddles are 1 */
+    l = 1;
+    if (m & 1) {
+        for (i=0;i<n;i+=2) {
+            t1r = re[i + 1];
+            t1i = im[i + 1];
+            re[i + 1] = re[i] - t1r;
+            im[i + 1] = im[i] - t1i;
+            re[i] += t1r;
+            im[i] += t1i;
+        }
+        l = 2;
+    }
 
-    /* Compute the FFT */
-    c1 = -1.0;
-    c2 = 0.0;
-    l2 = 1;
-    for (l=0;l<m;l++) {
-        l1 = l2;
-        l2 <<= 1;
-        u1 = 1.0;
-        u2 = 0.0;
+    /* Each radix-4 stage combines four l point transforms into one of 4l
+     * points. With a = W(4l)^j the inputs are scaled by 1, a^2, a, a^3 and
+     *   X0 = (x0 + a^2 x1) + (a x2 + a^3 x3)    X2 = (x0 + a^2 x1) - (a x2 + a^3 x3)
+     *   X1 = (x0 - a^2 x1) - i(a x2 - a^3 x3)   X3 = (x0 - a^2 x1) + i(a x2 - a^3 x3)
+     * W(4l)^j is entry j * FFT_TABLE_SIZE / 4l of the table, the table only
+     * holds the first half turn so a^3 past it is the negated entry */
+    for (;l<n;l<<=2) {
+        l4 = l << 2;
+        step = FFT_TABLE_SIZE / l4;
+        for (j=0;j<l;j++) {
+            w1r = FFT_TwiddleTable[2 * j * step].re;
+            w1i = FFT_TwiddleTable[2 * j * step].im;
+            w2r = FFT_TwiddleTable[j * step].re;
+            w2i = FFT_TwiddleTable[j * step].im;
+            k = 3 * j * step;
+            if (k < (long)(FFT_TABLE_SIZE / 2)) {
+                w3r = FFT_TwiddleTable[k].re;
+                w3i = FFT_TwiddleTable[k].im;
+            }
+            else {
+                w3r = -FFT_TwiddleTable[k - (FFT_TABLE_SIZE / 2)].re;
+                w3i = -FFT_TwiddleTable[k - (FFT_TABLE_SIZE / 2)].im;
+            }
+            if (dir != 1) {
+                w1i = -w1i;
+                w2i = -w2i;
+                w3i = -w3i;
+            }
+            for (i=j;i<n;i+=l4) {
+                i1 = i + l;
+                i2 = i1 + l;
+                i3 = i2 + l;
+
+                t1r = w1r * re[i1] - w1i * im[i1];
+                t1i = w1r * im[i1] + w1i * re[i1];
+                t2r = w2r * re[i2] - w2i * im[i2];
+                t2i = w2r * im[i2] + w2i * re[i2];
+                t3r = w3r * re[i3] - w3i * im[i3];
+                t3i = w3r * im[i3] + w3i * re[i3];
+
+                s0r = re[i] + t1r;
+                s0i = im[i] + t1i;
+                d0r = re[i] - t1r;
+                d0i = im[i] - t1i;
+                s1r = t2r + t3r;
+                s1i = t2i + t3i;
+                d1r = t2r - t3r;
+                d1i = t2i - t3i;
+
+                re[i] = s0r + s1r;
+                im[i] = s0i + s1i;
+                re[i2] = s0r - s1r;
+                im[i2] = s0i - s1i;
+                if (dir == 1) {
+                    /* -i rotates (d1r, d1i) to (d1i, -d1r) */
+                    re[i1] = d0r + d1i;
+                    im[i1] = d0i - d1r;
+                    re[i3] = d0r - d1i;
+                    im[i3] = d0i + d1r;
+                }
+                else {
+                    re[i1] = d0r - d1i;
+                    im[i1] = d0i + d1r;
+                    re[i3] = d0r + d1i;
+                    im[i3] = d0i - d1r;
+                }
+            }
+        }
+    }
+}
+#else
+static void FFT(int dir, long m, float* re, float* im)
+{
+    long n,i,i1,j,l1,l2,step;
+    float t1,t2,u1,u2;
+
+    if (m > (long)FFT_TABLE_POWER_OF_TWO)
+        return;
+
+    /* Calculate the number of points */
+    n = 1L << m;
+
+    FFT_BitReverse(m, re, im);
+
+    /* Compute the FFT, the twiddles of an l2 point stage are
+     * every FFT_TABLE_SIZE / l2 entries of the table */
+    step = FFT_TABLE_SIZE >> 1;
+    for (l2=2;l2<=n;l2<<=1) {
+        l1 = l2 >> 1;
         for (j=0;j<l1;j++) {
+            u1 = FFT_TwiddleTable[j * step].re;
+            u2 = FFT_TwiddleTable[j * step].im;
+            if (dir != 1)
+                u2 = -u2;
             for (i=j;i<n;i+=l2) {
                 i1 = i + l1;
                 t1 = u1 * re[i1] - u2 * im[i1];
@@ -330,38 +1463,620 @@ static void FFT(int dir, long m, float* re, float* im)
                 re[i] += t1;
                 im[i] += t2;
             }
-            z =  u1 * c1 - u2 * c2;
-            u2 = u1 * c2 + u2 * c1;
-            u1 = z;
         }
-        c2 = sqrt((1.0 - c1) / 2.0);
-        if (dir == 1)
-            c2 = -c2;
-        c1 = sqrt((1.0 + c1) / 2.0);
+        step >>= 1;
+    }
+}
+#endif
+
+#ifdef FFT_REAL_INPUT
+static void FFT_Real(long m, float* re, float* im, float* power)
+{
+    long n,k,nk,step;
+    float ar,ai,br,bi,er,ei,odr,odi,wr,wi,tr,ti;
+    float scale;
+
+    /* Half length complex transform of the interleaved samples */
+    FFT(1, m - 1, re, im);
+
+    /* Split it into the spectrum of the real sequence, n = N/2:
+     *   E[k] = (Z[k] + conj(Z[n-k])) / 2       even samples
+     *   O[k] = (Z[k] - conj(Z[n-k])) / 2i      odd samples
+     *   X[k]   = E[k] + W^k O[k]
+     *   X[n-k] = conj(E[k] - W^k O[k])
+     * W^k = e^(-2*pi*i*k/N) is every FFT_TABLE_SIZE / N entries of the table */
+    n = 1L << (m - 1);
+    step = FFT_TABLE_SIZE >> m;
+
+    /* Single sided power: (|X| / N)^2, four times that for all bins but DC and Nyquist */
+    scale = 1.0f / (float)(n << 1);
+    scale *= scale;
+
+    ar = re[0];
+    ai = im[0];
+    if (power) {
+        power[0] = (ar + ai) * (ar + ai) * scale;
+        power[n] = (ar - ai) * (ar - ai) * scale;
+    }
+    else {
+        re[0] = ar + ai;
+        im[0] = 0.0f;
+        re[n] = ar - ai;
+        im[n] = 0.0f;
+    }
+    scale *= 4.0f;
+
+    for (k=1;k<=(n>>1);k++) {
+        nk = n - k;
+        ar = re[k];
+        ai = im[k];
+        br = re[nk];
+        bi = -im[nk];
+
+        er = 0.5f * (ar + br);
+        ei = 0.5f * (ai + bi);
+        odr = 0.5f * (ai - bi);
+        odi = -0.5f * (ar - br);
+
+        wr = FFT_TwiddleTable[k * step].re;
+        wi = FFT_TwiddleTable[k * step].im;
+        tr = wr * odr - wi * odi;
+        ti = wr * odi + wi * odr;
+
+        if (power) {
+            power[k] = (((er + tr) * (er + tr)) + ((ei + ti) * (ei + ti))) * scale;
+            power[nk] = (((er - tr) * (er - tr)) + ((ei - ti) * (ei - ti))) * scale;
+        }
+        else {
+            re[k] = er + tr;
+            im[k] = ei + ti;
+            re[nk] = er - tr;
+            im[nk] = -(ei - ti);
+        }
+    }
+}
+#else
+static void FFT_PowerSpectrum(const float* re, const float* im, float* power, uint32_t count, float scale)
+{
+    uint32_t i = 0;
+
+    /* Two independent bins per iteration keep the FPU pipeline full */
+    for (; (i + 1) < count; i += 2) {
+        const float p0 = (re[i] * re[i]) + (im[i] * im[i]);
+        const float p1 = (re[i + 1] * re[i + 1]) + (im[i + 1] * im[i + 1]);
+
+        power[i] = p0 * scale;
+        power[i + 1] = p1 * scale;
+    }
+    if (i < count) {
+        power[i] = ((re[i] * re[i]) + (im[i] * im[i])) * scale;
+    }
+}
+#endif
+
+#endif /* !FFT_FIXED_POINT */
+
+#ifdef FFT_FIXED_POINT
+//////////////////////////////////////////////////////////////////////
+/// Packed Q15 arithmetic
+//////////////////////////////////////////////////////////////////////
+
+#define FFT_Q15_RE(v)           ((int16_t)((v) & 0xFFFFU))
+#define FFT_Q15_IM(v)           ((int16_t)((v) >> 16))
+
+static inline int32_t FFT_SatQ15(int32_t x)
+{
+    return (x > 32767) ? 32767 : ((x < -32768) ? -32768 : x);
+}
+
+static inline uint32_t FFT_PackQ15(int32_t re, int32_t im)
+{
+    return ((uint32_t)(uint16_t)re) | ((uint32_t)(uint16_t)im << 16);
+}
+
+#if defined(__GNUC__) && defined(__ARM_FEATURE_DSP)
+/* Cortex-M4 SIMD instructions, same style as REV_BYTES_32 in s32_core_cm4.h */
+#define FFT_DSP_INSTRUCTION(name, type, op)                             \
+static inline type name(uint32_t a, uint32_t b)                         \
+{                                                                       \
+    type r;                                                             \
+    __asm (op " %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));            \
+    return r;                                                           \
+}
+
+FFT_DSP_INSTRUCTION(FFT_QADD16, uint32_t, "qadd16")
+FFT_DSP_INSTRUCTION(FFT_QSUB16, uint32_t, "qsub16")
+FFT_DSP_INSTRUCTION(FFT_SHADD16, uint32_t, "shadd16")
+FFT_DSP_INSTRUCTION(FFT_SMUSD, int32_t, "smusd")
+FFT_DSP_INSTRUCTION(FFT_SMUADX, int32_t, "smuadx")
+FFT_DSP_INSTRUCTION(FFT_SMUAD, uint32_t, "smuad")
+#else
+/* Same results as the Cortex-M4 instructions, for other targets and host tests */
+static inline uint32_t FFT_QADD16(uint32_t a, uint32_t b)
+{
+    return FFT_PackQ15(FFT_SatQ15(FFT_Q15_RE(a) + FFT_Q15_RE(b)), FFT_SatQ15(FFT_Q15_IM(a) + FFT_Q15_IM(b)));
+}
+
+static inline uint32_t FFT_QSUB16(uint32_t a, uint32_t b)
+{
+    return FFT_PackQ15(FFT_SatQ15(FFT_Q15_RE(a) - FFT_Q15_RE(b)), FFT_SatQ15(FFT_Q15_IM(a) - FFT_Q15_IM(b)));
+}
+
+static inline uint32_t FFT_SHADD16(uint32_t a, uint32_t b)
+{
+    return FFT_PackQ15((FFT_Q15_RE(a) + FFT_Q15_RE(b)) >> 1, (FFT_Q15_IM(a) + FFT_Q15_IM(b)) >> 1);
+}
+
+static inline int32_t FFT_SMUSD(uint32_t a, uint32_t b)
+{
+    return ((int32_t)FFT_Q15_RE(a) * FFT_Q15_RE(b)) - ((int32_t)FFT_Q15_IM(a) * FFT_Q15_IM(b));
+}
+
+static inline int32_t FFT_SMUADX(uint32_t a, uint32_t b)
+{
+    return ((int32_t)FFT_Q15_RE(a) * FFT_Q15_IM(b)) + ((int32_t)FFT_Q15_IM(a) * FFT_Q15_RE(b));
+}
+
+static inline uint32_t FFT_SMUAD(uint32_t a, uint32_t b)
+{
+    return (uint32_t)((int32_t)FFT_Q15_RE(a) * FFT_Q15_RE(b)) + (uint32_t)((int32_t)FFT_Q15_IM(a) * FFT_Q15_IM(b));
+}
+#endif
+
+/* re^2 + im^2 in Q30, unsigned as it reaches 2^31 */
+static inline uint32_t FFT_PowerQ30(uint32_t v)
+{
+    return FFT_SMUAD(v, v);
+}
+
+/* w * b, rounded back to Q15 */
+static inline uint32_t FFT_ComplexMulQ15(uint32_t w, uint32_t b)
+{
+    return FFT_PackQ15((FFT_SMUSD(w, b) + 0x4000) >> 15, (FFT_SMUADX(w, b) + 0x4000) >> 15);
+}
+
+static inline uint32_t FFT_ScaleQ15(uint32_t v, uint8_t shift)
+{
+    while (shift--)
+    {
+        v = FFT_SHADD16(v, 0);
+    }
+    return v;
+}
+
+static inline int32_t FFT_PeakQ15(int32_t peak, uint32_t v)
+{
+    int32_t re = FFT_Q15_RE(v);
+    int32_t im = FFT_Q15_IM(v);
+
+    if (re < 0) re = -re;
+    if (im < 0) im = -im;
+    if (re > peak) peak = re;
+    if (im > peak) peak = im;
+
+    return peak;
+}
+
+//////////////////////////////////////////////////////////////////////
+/// Fixed point analysis
+//////////////////////////////////////////////////////////////////////
+
+static uint8_t FFT_GetFrequencyResponseQ15(uint32_t start, float* freqResponsePerBand)
+{
+#ifdef FFT_REAL_INPUT
+    /* Even samples in the real and odd samples in the imaginary half words,
+     * the spectrum comes back in place */
+    const uint32_t count = FFT_SAMPLE_MAX / 2;
+#else
+    const uint32_t count = FFT_SAMPLE_MAX;
+#endif
+    uint32_t* audio = &FFT_Arena.audio[0];
+    /* Amplitude of a bin in Q15 units to volts, including the 1 / FFT_SAMPLE_MAX */
+    const float voltsPerUnit = (FFT_ADC_REFERENCE / FFT_ADC_MAX)
+                               / (1U << FFT_ADC_TO_Q15_SHIFT) / FFT_SAMPLE_MAX;
+    const int16_t* window = &FFT_WindowTableQ15[FFT_WindowRow[FFT_window]][0];
+    float energy[FFT_BAND_SLOTS] = {0};
+    FFT_PeakSearch_T search;
+    int8_t exponent;
+    float scale;
+
+    /* Copy samples as fast as possible, 12 bits around midscale to Q15 */
+    for(uint32_t i = 0; i < count; i++)
+    {
+#ifdef FFT_REAL_INPUT
+        audio[i] = FFT_PackQ15(
+            ((int32_t)FFT_FrameSample(start, 2 * i) - FFT_ADC_MIDSCALE) << FFT_ADC_TO_Q15_SHIFT,
+            ((int32_t)FFT_FrameSample(start, (2 * i) + 1) - FFT_ADC_MIDSCALE) << FFT_ADC_TO_Q15_SHIFT);
+#else
+        audio[i] = FFT_PackQ15(
+            ((int32_t)FFT_FrameSample(start, i) - FFT_ADC_MIDSCALE) << FFT_ADC_TO_Q15_SHIFT, 0);
+#endif
+    }
+
+    /* The frame is no longer needed in the ring */
+    if (0 == FFT_ReleaseFrame())
+    {
+        return 0;
+    }
+
+    /* Apply window */
+    for(uint32_t i = 0; i < count; i++)
+    {
+#ifdef FFT_REAL_INPUT
+        audio[i] = FFT_PackQ15(
+            ((FFT_Q15_RE(audio[i]) * FFT_WindowCoefficientQ15(window, 2 * i)) + 0x4000) >> 15,
+            ((FFT_Q15_IM(audio[i]) * FFT_WindowCoefficientQ15(window, (2 * i) + 1)) + 0x4000) >> 15);
+#else
+        audio[i] = FFT_PackQ15(
+            ((FFT_Q15_RE(audio[i]) * FFT_WindowCoefficientQ15(window, i)) + 0x4000) >> 15, 0);
+#endif
+    }
+
+    /* Calculate FFT */
+#ifdef FFT_REAL_INPUT
+    exponent = FFT_RealQ15(FFT_POWER_OF_TWO, &audio[0]);
+#else
+    {
+        int32_t peak;
+        exponent = FFT_Q15(FFT_POWER_OF_TWO, &audio[0], &peak);
+    }
+#endif
+
+    /* Accumulate the power of the bins per band and find the peaks over the
+     * whole spectrum, every bin but DC and Nyquist has four times the power
+     * as in the float path */
+    scale = ldexpf(voltsPerUnit * voltsPerUnit, 2 * exponent);
+
+    FFT_StartPeakSearch(&search);
+    for (uint32_t bin = FFT_PEAK_FIRST_BIN; bin < FFT_FREQUENCY_RESP_SIZE; bin++)
+    {
+        const float binScale = ((FFT_FREQUENCY_RESP_SIZE - 1) == bin) ? scale : (4.0f * scale);
+        const float power = (float)FFT_PowerQ30(audio[bin]) * binScale;
+
+        if ((bin >= FFT_firstBin) && (bin <= FFT_lastBin))
+        {
+            FFT_AddBinPower(energy, bin, power);
+        }
+        FFT_SearchPeak(&search, bin, power);
+    }
+
+    FFT_GetBandLevels(energy, freqResponsePerBand);
+    FFT_FinishPeakSearch(&search, FFT_PEAK_SEARCH_BINS);
+
+    return 1;
+}
+
+static int8_t FFT_Q15(long m, uint32_t* data, int32_t* peak)
+{
+    long n,i,i1,j,k,i2,l1,l2,step;
+    uint32_t a,t,w,count;
+    int32_t largest = 0;
+    int8_t exponent = 0;
+    uint8_t shift;
+    const uint16_t (*swaps)[2];
+
+    *peak = 0;
+    if (m > (long)FFT_TABLE_POWER_OF_TWO)
+        return 0;
+
+    /* Calculate the number of points */
+    n = 1L << m;
+
+    /* Do the bit reversal */
+    swaps = FFT_BitReverseSwaps(n, &count);
+    if (swaps) {
+        for (uint32_t s = 0; s < count; s++) {
+            t = data[swaps[s][0]];
+            data[swaps[s][0]] = data[swaps[s][1]];
+            data[swaps[s][1]] = t;
+        }
+    }
+    else {
+        i2 = n >> 1;
+        j = 0;
+        for (i=0;i<n-1;i++) {
+            if (i < j) {
+                t = data[i];
+                data[i] = data[j];
+                data[j] = t;
+            }
+            k = i2;
+            while (k <= j) {
+                j -= k;
+                k >>= 1;
+            }
+            j += k;
+        }
+    }
+
+    for (i=0;i<n;i++)
+        largest = FFT_PeakQ15(largest, data[i]);
+
+    /* Compute the FFT */
+    step = FFT_TABLE_SIZE >> 1;
+    for (l2=2;l2<=n;l2<<=1) {
+        /* Scale the whole block down until no butterfly can saturate */
+        shift = 0;
+        while (largest > FFT_Q15_BUTTERFLY_MAX) {
+            largest >>= 1;
+            shift++;
+        }
+        exponent += shift;
+        largest = 0;
+
+        l1 = l2 >> 1;
+        for (j=0;j<l1;j++) {
+            w = FFT_TwiddleTableQ15[j * step];
+            for (i=j;i<n;i+=l2) {
+                i1 = i + l1;
+                a = FFT_ScaleQ15(data[i], shift);
+                t = FFT_ComplexMulQ15(w, FFT_ScaleQ15(data[i1], shift));
+                data[i] = FFT_QADD16(a, t);
+                data[i1] = FFT_QSUB16(a, t);
+                largest = FFT_PeakQ15(largest, data[i]);
+                largest = FFT_PeakQ15(largest, data[i1]);
+            }
+        }
+        step >>= 1;
+    }
+
+    *peak = largest;
+    return exponent;
+}
+
+#ifdef FFT_REAL_INPUT
+static int8_t FFT_RealQ15(long m, uint32_t* data)
+{
+    long n,k,nk,step;
+    int32_t ar,ai,br,bi,er,ei,odr,odi,tr,ti,peak;
+    uint32_t w;
+    int8_t exponent;
+    uint8_t shift = 0;
+
+    /* Half length complex transform of the interleaved samples */
+    exponent = FFT_Q15(m - 1, data, &peak);
+
+    /* The split is a butterfly too, scale it the same way */
+    while (peak > FFT_Q15_BUTTERFLY_MAX) {
+        peak >>= 1;
+        shift++;
+    }
+    exponent += shift;
+
+    /* Same split as FFT_Real(), with E and O computed halved */
+    n = 1L << (m - 1);
+    step = FFT_TABLE_SIZE >> m;
+
+    ar = FFT_Q15_RE(data[0]);
+    ai = FFT_Q15_IM(data[0]);
+    data[0] = FFT_PackQ15(FFT_SatQ15((ar + ai) >> shift), 0);
+    data[n] = FFT_PackQ15(FFT_SatQ15((ar - ai) >> shift), 0);
+
+    for (k=1;k<=(n>>1);k++) {
+        nk = n - k;
+        ar = FFT_Q15_RE(data[k]);
+        ai = FFT_Q15_IM(data[k]);
+        br = FFT_Q15_RE(data[nk]);
+        bi = -FFT_Q15_IM(data[nk]);
+
+        er = (ar + br) >> 1;
+        ei = (ai + bi) >> 1;
+        odr = (ai - bi) >> 1;
+        odi = (br - ar) >> 1;
+
+        w = FFT_TwiddleTableQ15[k * step];
+        tr = (((int32_t)FFT_Q15_RE(w) * odr) - ((int32_t)FFT_Q15_IM(w) * odi) + 0x4000) >> 15;
+        ti = (((int32_t)FFT_Q15_RE(w) * odi) + ((int32_t)FFT_Q15_IM(w) * odr) + 0x4000) >> 15;
+
+        data[k] = FFT_PackQ15(FFT_SatQ15((er + tr) >> shift), FFT_SatQ15((ei + ti) >> shift));
+        data[nk] = FFT_PackQ15(FFT_SatQ15((er - tr) >> shift), FFT_SatQ15((ti - ei) >> shift));
+    }
+
+    return exponent;
+}
+#endif
+
+#endif /* FFT_FIXED_POINT */
+
+static void FFT_GetBandLevels(const float* energy, float* freqResponsePerBand)
+{
+    /* A tone of amplitude A spreads A^2 times the power gain of the window
+     * over its bins, whichever window it is */
+    const float gain = 1.0f / FFT_WindowGains[FFT_window].power;
+
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        freqResponsePerBand[currentBand] = FFT_SqrtF(energy[currentBand + 1] * gain);
+    }
+}
+
+static void FFT_Initialize_Band_Tables(void)
+{
+    const float binHz = FFT_SAMPLING_FREQUENCY_HZ / FFT_SAMPLE_MAX;
+    uint32_t slot = 0;
+
+    FFT_firstBin = FFT_FREQUENCY_RESP_SIZE;
+    FFT_lastBin = 0;
+    (void)memset(&FFT_BinSlot[0], 0, sizeof(FFT_BinSlot));
+    (void)memset(&FFT_BinWeight[0], 0, sizeof(FFT_BinWeight));
+
+    /* Bin k covers (k - 1/2) to (k + 1/2) bins, a band edge inside it
+     * splits its power in proportion. Bands are expected to be at least a
+     * bin wide, a second edge in the same bin moves to the next bin */
+    for (uint32_t bin = FFT_DC_BINS; bin < FFT_FREQUENCY_RESP_SIZE; bin++)
+    {
+        const float low = ((float)bin - 0.5f) * binHz;
+        const float high = low + binHz;
+
+        /* Slot holding the lower end of the bin */
+        while ((slot <= FFT_FREQ_BANDS) && (low >= FFT_BandEdges[slot]))
+        {
+            slot++;
+        }
+
+        FFT_BinSlot[bin] = (uint8_t)slot;
+        if ((slot <= FFT_FREQ_BANDS) && (high > FFT_BandEdges[slot]))
+        {
+            FFT_BinWeight[bin] = (FFT_BandEdges[slot] - low) / binHz;
+        }
+        else
+        {
+            FFT_BinWeight[bin] = 1.0f;
+        }
+
+        /* In a band unless it is all below the first or above the last */
+        if ((slot <= FFT_FREQ_BANDS) && ((slot > 0) || (FFT_BinWeight[bin] < 1.0f)))
+        {
+            if (FFT_firstBin > bin)
+            {
+                FFT_firstBin = bin;
+            }
+            FFT_lastBin = bin;
+        }
     }
 }
 
-static void FFT_Initialize_Hamming(void)
+static void FFT_AddPeakCandidate(FFT_PeakSearch_T* search, uint32_t bin, float next)
 {
-    float v;
-    int N = sizeof(FFT_HammingWindow) / sizeof(FFT_HammingWindow[0]);
+    uint32_t i = (search->found < FFT_PEAK_MAX) ? search->found++ : (FFT_PEAK_MAX - 1);
 
-    for (int n = 0; n < N; ++n)
+    /* Insertion into the candidates sorted by power, the weakest drops out */
+    while ((i > 0) && (search->power[i - 1][1] < search->last))
     {
-        v = 0.54 - (0.46 * cos((2.0 * FFT_PI * (float)n) / ((float)N - 1.0)));
-        FFT_HammingWindow[n] = v;
+        search->bin[i] = search->bin[i - 1];
+        search->power[i][0] = search->power[i - 1][0];
+        search->power[i][1] = search->power[i - 1][1];
+        search->power[i][2] = search->power[i - 1][2];
+        i--;
     }
+
+    search->bin[i] = (uint16_t)bin;
+    search->power[i][0] = search->before;
+    search->power[i][1] = search->last;
+    search->power[i][2] = next;
 }
 
+static void FFT_FinishPeakSearch(const FFT_PeakSearch_T* search, uint32_t bins)
+{
+    const float binHz = FFT_SAMPLING_FREQUENCY_HZ / FFT_SAMPLE_MAX;
+    const float coherent = FFT_WindowGains[FFT_window].coherent;
+    float floorLog2;
+    float thresholdLog2;
+    float minimumLog2;
+
+    FFT_peaks.count = 0;
+    FFT_peaks.noiseFloor = 0.0f;
+    if (0 == bins)
+    {
+        return;
+    }
+
+    /* Noise floor power as the mean of the log2 powers, the threshold is
+     * FFT_PEAK_THRESHOLD_DB above it (10 * log10(2) dB per log2 of power),
+     * but not below the bin power of a tone of FFT_PEAK_MIN_VOLTS */
+    floorLog2 = search->logSum / (float)bins;
+    thresholdLog2 = floorLog2 + (FFT_PEAK_THRESHOLD_DB / (0.5f * FFT_DB_PER_LOG2));
+    minimumLog2 = FFT_FastLog2((FFT_PEAK_MIN_VOLTS * coherent * FFT_PEAK_MIN_VOLTS * coherent) + FFT_PEAK_POWER_MIN);
+    if (thresholdLog2 < minimumLog2)
+    {
+        thresholdLog2 = minimumLog2;
+    }
+    FFT_peaks.noiseFloor = exp2f(0.5f * floorLog2) / coherent;
+
+    for (uint32_t i = 0; i < search->found; i++)
+    {
+        const float* p = &search->power[i][0];
+        float delta;
+        float magnitude;
+
+        /* Candidates are in order of power, the rest are weaker still */
+        if (FFT_FastLog2(p[1] + FFT_PEAK_POWER_MIN) <= thresholdLog2)
+        {
+            break;
+        }
+
+        /* Offset of the vertex from the peak bin, within +-0.5 bins, and
+         * the magnitude at the vertex */
+#if (FFT_PEAK_INTERPOLATION == FFT_PEAK_GAUSSIAN)
+        {
+            const float a = FFT_FastLog2(p[0] + FFT_PEAK_POWER_MIN);
+            const float b = FFT_FastLog2(p[1] + FFT_PEAK_POWER_MIN);
+            const float c = FFT_FastLog2(p[2] + FFT_PEAK_POWER_MIN);
+
+            delta = (0.5f * (a - c)) / ((a - (2.0f * b)) + c);
+            magnitude = exp2f(0.5f * (b - (0.25f * (a - c) * delta)));
+        }
+#else
+        {
+            const float a = FFT_SqrtF(p[0]);
+            const float b = FFT_SqrtF(p[1]);
+            const float c = FFT_SqrtF(p[2]);
+
+            delta = (0.5f * (a - c)) / ((a - (2.0f * b)) + c);
+            magnitude = b - (0.25f * (a - c) * delta);
+        }
+#endif
+
+        FFT_peaks.peak[FFT_peaks.count].frequency = ((float)search->bin[i] + delta) * binHz;
+        FFT_peaks.peak[FFT_peaks.count].amplitude = magnitude / coherent;
+        FFT_peaks.count++;
+    }
+}
+#endif /* FFT_GOERTZEL */
+
 static void FFT_Initialize_Frequency_Bands(void)
 {
-    FFT_elementsPerBand = FFT_FREQUENCY_RESP_SIZE / FFT_FREQ_BANDS;
+    const double nyquistHz = FFT_SAMPLING_FREQUENCY_HZ / 2;
+
+#if (FFT_BAND_LAYOUT == FFT_BANDS_LINEAR)
+    /* Equal widths from DC to Nyquist */
+    for (uint32_t currentBand = 0; currentBand <= FFT_FREQ_BANDS; currentBand++)
+    {
+        FFT_BandEdges[currentBand] = (nyquistHz * currentBand) / FFT_FREQ_BANDS;
+    }
+
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        FFT_Frequency_Bands[currentBand] = (FFT_BandEdges[currentBand] + FFT_BandEdges[currentBand + 1]) / 2;
+    }
+#elif (FFT_BAND_LAYOUT == FFT_BANDS_CUSTOM)
+    static const float edges[FFT_FREQ_BANDS + 1] = FFT_BAND_EDGES_HZ;
+
+    for (uint32_t currentBand = 0; currentBand <= FFT_FREQ_BANDS; currentBand++)
+    {
+        FFT_BandEdges[currentBand] = (edges[currentBand] < nyquistHz) ? edges[currentBand] : nyquistHz;
+    }
+
+    /* Geometric centres, the middle for a band starting at DC */
+    for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
+    {
+        const float low = FFT_BandEdges[currentBand];
+        const float high = FFT_BandEdges[currentBand + 1];
+
+        FFT_Frequency_Bands[currentBand] = (low > 0) ? sqrtf(low * high) : (high / 2);
+    }
+#else
+    /* Centres of the IEC 61260 base two series, 1kHz * 2^(k / bandsPerOctave),
+     * edges half a band either side. The top band is the last one starting
+     * below Nyquist, it ends at Nyquist */
+#if (FFT_BAND_LAYOUT == FFT_BANDS_OCTAVE)
+    const double bandsPerOctave = 1.0;
+#else
+    const double bandsPerOctave = 3.0;
+#endif
+    const int32_t top = (int32_t)ceil((bandsPerOctave * log2(nyquistHz / 1000.0)) + 0.5) - 1;
+    const int32_t first = top - (int32_t)FFT_FREQ_BANDS + 1;
+
+    for (uint32_t currentBand = 0; currentBand <= FFT_FREQ_BANDS; currentBand++)
+    {
+        const double edge = 1000.0 * pow(2.0, ((double)(first + (int32_t)currentBand) - 0.5) / bandsPerOctave);
+
+        FFT_BandEdges[currentBand] = (edge < nyquistHz) ? edge : nyquistHz;
+    }
 
-    /* For each band, get its center by dividing the elementsPerBand by 2 */
     for (uint32_t currentBand = 0; currentBand < FFT_FREQ_BANDS; currentBand++)
     {
-        FFT_Frequency_Bands[currentBand] =
-            (FFT_SAMPLING_FREQUENCY_HZ / FFT_SAMPLE_MAX)
-            * (((float)FFT_elementsPerBand / 2) + ((float)currentBand * FFT_elementsPerBand));
+        FFT_Frequency_Bands[currentBand] = 1000.0 * pow(2.0, (double)(first + (int32_t)currentBand) / bandsPerOctave);
     }
+#endif
 }
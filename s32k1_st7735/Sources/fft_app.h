@@ -18,13 +18,36 @@
 //////////////////////////////////////////////////////////////////////
 
 #include <stdint.h>
+#include "fft_tables.h"
+#include "fft_app_cfg.h"
 
 //////////////////////////////////////////////////////////////////////
 /// Exported defines
 //////////////////////////////////////////////////////////////////////
 
-/* How many bands will be shown on screen */
+/* How many bands will be shown on screen, tools/fft_test.c bench builds
+ * with others to compare the FFT and the FFT_GOERTZEL load */
+#ifndef FFT_FREQ_BANDS
 #define FFT_FREQ_BANDS                                  (8U)
+#endif
+
+//////////////////////////////////////////////////////////////////////
+/// Exported types
+//////////////////////////////////////////////////////////////////////
+
+/* A peak of the spectrum, see FFT_GetPeaks */
+typedef struct FFT_Peak_Tag
+{
+    float frequency;                    /* Hz, interpolated between bins */
+    float amplitude;                    /* Volts, of a tone at that frequency */
+} FFT_Peak_T;
+
+typedef struct FFT_Peaks_Tag
+{
+    FFT_Peak_T peak[FFT_PEAK_MAX];      /* Strongest first */
+    uint8_t count;                      /* Peaks found, 0 to FFT_PEAK_MAX */
+    float noiseFloor;                   /* Volts, what a bin at the noise floor reads as a tone */
+} FFT_Peaks_T;
 
 //////////////////////////////////////////////////////////////////////
 /// Exported variables
@@ -47,21 +70,78 @@ void FFT_Initialize(void);
 void FFT_GetSample(uint16_t sample);
 
 /**
- * Notify that the buffer is now available for writing new audio samples
+ * Discard the frames that are ready, counting them as dropped, sampling never stops
  */
 void FFT_SetBufferAvailable(void);
 
 /**
- * Get a flag reporting if all samples are ready to be processed
+ * Get a flag reporting if a new frame of samples is ready to be processed
  * @return 0  if not ready, 1 if ready
  */
 uint8_t FFT_GetBufferReady(void);
 
 /**
- * Get the calculated frequency responses in 10 bands
+ * Get the number of frames that were never analysed since FFT_Initialize,
+ * because a newer one was ready first, the ring wrapped while copying or
+ * FFT_SetBufferAvailable discarded them
+ * @return dropped frames
+ */
+uint32_t FFT_GetDroppedFrames(void);
+
+/**
+ * Get the calculated frequency responses in FFT_FREQ_BANDS bands (FFT_BAND_LAYOUT),
+ * each the amplitude in volts of a tone with the same power as the band
  * @param freqResponsePerBand - a pointer to an array of FFT_FREQ_BANDS float variables
+ * @return 1 if updated, 0 if no frame was ready or the ring overwrote it while
+ *         it was copied (a dropped frame), then the bands and peaks are unchanged
+ */
+uint8_t FFT_GetFrequencyResponse(float* freqResponsePerBand);
+
+/**
+ * Smooth the band levels of the last FFT_GetFrequencyResponse over time, call
+ * it once per frame before FFT_PlotFrequencyResponse: RMS over
+ * FFT_SMOOTH_RMS_FRAMES frames, then attack and release (FFT_SMOOTH_ATTACK_MS,
+ * FFT_SMOOTH_RELEASE_MS). Also updates the peak hold that the plot draws
+ * (FFT_HOLD_MS, FFT_HOLD_FALL_DB_PER_S).
+ * @param freqResponsePerBand - a pointer to an array of FFT_FREQ_BANDS float variables,
+ *                              replaced by the smoothed levels
+ */
+void FFT_SmoothFrequencyResponse(float* freqResponsePerBand);
+
+/**
+ * Select the window applied before the FFT, from the next frame on.
+ * Band levels stay calibrated, they are corrected by the power gain of the window.
+ * The FFT_GOERTZEL filter bank always uses its own Hann window.
+ * @param window - FFT_WINDOW_HANN, FFT_WINDOW_HAMMING, FFT_WINDOW_BLACKMAN_HARRIS,
+ *                 FFT_WINDOW_FLAT_TOP or FFT_WINDOW_KAISER
+ * @return 1 if selected, 0 if window is unknown or not in FFT_WINDOWS (the
+ *         windows tools/fft_tables.py generated)
+ */
+uint8_t FFT_SetWindow(uint8_t window);
+
+/**
+ * Get the gains of the selected window: coherent gain (tone amplitude at a
+ * bin centre), power gain and equivalent noise bandwidth in bins
+ * @return the gains
+ */
+const FFT_WindowGain_T* FFT_GetWindowGain(void);
+
+/**
+ * Get the peaks of the last frame from FFT_GetFrequencyResponse, the
+ * strongest FFT_PEAK_MAX local maxima of the bins above DC, in the bands or
+ * not, that are FFT_PEAK_THRESHOLD_DB above the noise floor and at least
+ * FFT_PEAK_MIN_VOLTS, interpolated between bins (FFT_PEAK_INTERPOLATION).
+ * The FFT_GOERTZEL filter bank finds no peaks.
+ * @return the peaks
+ */
+const FFT_Peaks_T* FFT_GetPeaks(void);
+
+/**
+ * Convert a band level to decibels with a fast log2, within 0.03dB
+ * @param level - band level in volts
+ * @return 20 * log10(level), dB relative to 1V
  */
-void FFT_GetFrequencyResponse(float* freqResponsePerBand);
+float FFT_GetDecibels(float level);
 
 /**
  * Plot on TFT ST7735 the frequency response
@@ -0,0 +1,233 @@
+/***************************************************
+  DESCRIPTION
+
+  Build options for the FFT example (fft_app.c).
+
+  Use at your own risk.
+
+  AUTHOR (modifier)
+  migsantiago.com / May 2020
+
+ ****************************************************/
+
+#ifndef FFT_APP_CFG_H
+#define FFT_APP_CFG_H
+
+//////////////////////////////////////////////////////////////////////
+/// Acquisition
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * The ADC interrupt writes into a ring of FFT_ACQUISITION_BUFFERS frames
+ * and never stops. The newest complete frame is read straight from the
+ * ring, it must be copied out before the ring wraps onto it
+ * (FFT_ACQUISITION_BUFFERS - 1 frames later). 2 or 3.
+ */
+#define FFT_ACQUISITION_BUFFERS                         (2U)
+
+/**
+ * Overlap between consecutive analysis frames in percent: 0, 50 or 75.
+ * A new frame is ready every FFT_SAMPLE_MAX * (100 - overlap) / 100 samples.
+ */
+#define FFT_OVERLAP_PERCENT                             (0U)
+
+/**
+ * The build stops when the acquisition ring, the DSP scratch and the band
+ * tables of the configuration need more than this. They are all .bss, in
+ * the 32KB m_data of the flash build or the 28KB m_data of the RAM build,
+ * shared with the rest of the application and, in the RAM build, with the
+ * 6KB stack (STACK_SIZE in the linker file). tools/fft_tables.py prints what
+ * each configuration needs, the full complex FFT in float needs more than
+ * 28KB. The RAM build also runs from RAM: code and constants share its 31KB
+ * m_text, and the constant tables of the float FFT alone take 18KB with one
+ * window (34KB with all five, see FFT_DEFAULT_WINDOW).
+ */
+#define FFT_RAM_BUDGET_BYTES                            (28672U)
+
+//////////////////////////////////////////////////////////////////////
+/// Transform
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * The ADC samples are real, so their spectrum can be computed with an
+ * FFT_SAMPLE_MAX / 2 point complex FFT (even samples as the real part,
+ * odd samples as the imaginary part) and a split pass that separates the
+ * two halves. This is about half the work and half the scratch memory of
+ * a full complex FFT with an all-zero imaginary part, for the same bins.
+ *
+ * Comment this out to use the full complex FFT.
+ */
+#define FFT_REAL_INPUT
+
+/**
+ * Window applied before the FFT until FFT_SetWindow selects another one:
+ * FFT_WINDOW_HANN, FFT_WINDOW_HAMMING, FFT_WINDOW_BLACKMAN_HARRIS,
+ * FFT_WINDOW_FLAT_TOP or FFT_WINDOW_KAISER. Each is a const table of
+ * FFT_SAMPLE_MAX / 2 coefficients (4KB in float, 2KB in Q15) generated by
+ * tools/fft_tables.py, only for the windows in its --windows option
+ * (FFT_WINDOWS in fft_tables.h). The tables are generated with Hamming
+ * alone, FFT_SetWindow rejects the others until they are added.
+ */
+#define FFT_DEFAULT_WINDOW                              FFT_WINDOW_HAMMING
+
+/**
+ * Use the radix-4 float FFT: one radix-2 stage for odd powers of two, then
+ * radix-4 stages that each do the work of two radix-2 stages with 3 instead
+ * of 4 complex multiplications per 4 points. 2048 points take 6 passes over
+ * the data instead of 11.
+ *
+ * Comment this out to use the radix-2 FFT.
+ */
+#define FFT_RADIX4
+
+/**
+ * Run the analysis in fixed point: Q15 samples and window, a Q15 FFT with
+ * block floating point scaling (a stage is only scaled down when one of its
+ * butterflies could saturate) and Q31 magnitudes. The Cortex-M4 DSP
+ * instructions (SMUSD, SMUADX, QADD16...) are used when the compiler
+ * targets them, portable C otherwise. Band levels are still in volts.
+ *
+ * Uncomment this to use the fixed point path instead of float.
+ */
+//#define FFT_FIXED_POINT
+
+//////////////////////////////////////////////////////////////////////
+/// Bands
+//////////////////////////////////////////////////////////////////////
+
+#define FFT_BANDS_LINEAR                                (0U)
+#define FFT_BANDS_OCTAVE                                (1U)
+#define FFT_BANDS_THIRD_OCTAVE                          (2U)
+#define FFT_BANDS_CUSTOM                                (3U)
+
+/**
+ * How the spectrum is split into the FFT_FREQ_BANDS bars:
+ * FFT_BANDS_LINEAR        equal widths from DC to Nyquist
+ * FFT_BANDS_OCTAVE        octaves centred on 1kHz * 2^k, the highest one
+ *                         ends at Nyquist (63Hz to 8kHz for 8 bands)
+ * FFT_BANDS_THIRD_OCTAVE  third octaves centred on 1kHz * 2^(k/3), the
+ *                         same way (2kHz to 10kHz for 8 bands)
+ * FFT_BANDS_CUSTOM        the edges in FFT_BAND_EDGES_HZ
+ * The power of the bins is summed per band, a bin on an edge is split
+ * between both bands in proportion.
+ */
+#define FFT_BAND_LAYOUT                                 FFT_BANDS_OCTAVE
+
+/**
+ * FFT_FREQ_BANDS + 1 ascending band edges in Hz for FFT_BANDS_CUSTOM,
+ * each band at least one bin (about 10Hz) wide.
+ */
+#define FFT_BAND_EDGES_HZ                               { 40, 100, 250, 500, 1000, 2000, 3500, 6000, 10000 }
+
+/**
+ * Draw the bars on a decibel scale, 0.5V at the top and
+ * FFT_PLOT_DECIBEL_RANGE dB below that at the bottom.
+ *
+ * Comment this out for a linear scale.
+ */
+//#define FFT_PLOT_DECIBELS
+#define FFT_PLOT_DECIBEL_RANGE                          (48.0f)
+
+//////////////////////////////////////////////////////////////////////
+/// Smoothing
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * FFT_SmoothFrequencyResponse follows a rising band level with a time
+ * constant of FFT_SMOOTH_ATTACK_MS and a falling one with
+ * FFT_SMOOTH_RELEASE_MS, 0 follows at once. A frame comes every 102.4ms
+ * without overlap, shorter time constants are close to 0. The time is taken
+ * from the frames, dropped ones included, so it does not depend on how fast
+ * the screen is drawn.
+ */
+#define FFT_SMOOTH_ATTACK_MS                            (50U)
+#define FFT_SMOOTH_RELEASE_MS                           (400U)
+
+/**
+ * Before that, each band is averaged as the RMS of its levels in the last
+ * FFT_SMOOTH_RMS_FRAMES frames, 1 for no averaging.
+ */
+#define FFT_SMOOTH_RMS_FRAMES                           (1U)
+
+/**
+ * The highest smoothed level of each band is held for FFT_HOLD_MS, then it
+ * falls by FFT_HOLD_FALL_DB_PER_S. It is drawn as a line above the bar.
+ * 0 for no peak hold.
+ */
+#define FFT_HOLD_MS                                     (1000U)
+#define FFT_HOLD_FALL_DB_PER_S                          (24.0f)
+
+//////////////////////////////////////////////////////////////////////
+/// Peaks
+//////////////////////////////////////////////////////////////////////
+
+#define FFT_PEAK_PARABOLIC                              (0U)
+#define FFT_PEAK_GAUSSIAN                               (1U)
+
+/**
+ * The strongest FFT_PEAK_MAX local maxima of the bins are found while the
+ * bands are summed, see FFT_GetPeaks. The whole spectrum is searched above
+ * the DC bins, whatever FFT_BAND_LAYOUT covers.
+ */
+#define FFT_PEAK_MAX                                    (4U)
+
+/**
+ * A peak is only reported FFT_PEAK_THRESHOLD_DB above the noise floor, the
+ * geometric mean of the bin powers. For noise that is 2.5dB below their
+ * mean, and a few strong tones barely move it. At 15dB a bin of white noise
+ * passes about once in 50 million.
+ */
+#define FFT_PEAK_THRESHOLD_DB                           (15.0f)
+
+/**
+ * A peak is also only reported from FFT_PEAK_MIN_VOLTS up. Window sidelobes
+ * of strong tones and ADC spurs are local maxima well above the noise
+ * floor: a 0.5V tone has Hamming sidelobes of 3.5mV beside it. 0 for no
+ * absolute floor.
+ */
+#define FFT_PEAK_MIN_VOLTS                              (0.01f)
+
+/**
+ * How the frequency and amplitude of a peak are estimated between bins,
+ * from the peak bin and its two neighbours:
+ * FFT_PEAK_PARABOLIC  parabola through the magnitudes
+ * FFT_PEAK_GAUSSIAN   parabola through the log powers, exact for a Gaussian
+ *                     main lobe: within 0.2Hz and 0.4dB for Hamming, 2 to 4
+ *                     times closer than FFT_PEAK_PARABOLIC. The same for the
+ *                     flat top window, which is within 1.4Hz either way.
+ */
+#define FFT_PEAK_INTERPOLATION                          FFT_PEAK_GAUSSIAN
+
+/**
+ * Show the frequency of the strongest peak at the top of the screen instead
+ * of the title, as a frequency counter. Only the digits that change are
+ * redrawn.
+ *
+ * Uncomment this to show the peak frequency.
+ */
+//#define FFT_PLOT_PEAK
+
+//////////////////////////////////////////////////////////////////////
+/// Filter bank
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * Replace the FFT with a bank of Goertzel filters updated by FFT_GetSample,
+ * two per band a quarter of the band in from its edges. They run over Hann
+ * windowed blocks of 3 * sampling frequency / band width samples (at most
+ * a frame) and their block energies are summed and averaged over a frame
+ * hop. A band reads a tone anywhere in it within +0.4dB/-3dB, and with the
+ * octave layout a tone at a band centre reads 18dB down in the band above,
+ * 42dB down in the band below and 35dB or more down in the others; the FFT
+ * keeps 35dB or more everywhere (tools/fft_test.c bands). The work is about
+ * ten multiplies and adds per band per sample in the interrupt, the main
+ * loop only takes a square root per band. There is no acquisition ring or
+ * FFT scratch. Band levels are in volts, the same as the FFT for a tone at
+ * the middle of a band.
+ *
+ * Uncomment this to use the filter bank instead of the FFT. It cannot be
+ * combined with FFT_FIXED_POINT.
+ */
+//#define FFT_GOERTZEL
+
+#endif /* FFT_APP_CFG_H */
@@ -0,0 +1,937 @@
+/* Generated by tools/fft_tables.py -n 2048 --windows hamming, do not edit */
+
+#include "fft_tables.h"
+
+const FFT_Complex_T FFT_TwiddleTable[FFT_TABLE_SIZE / 2] =
+{
+    { 1.0f, 0.0f }, { 0.999995294f, -0.00306795676f }, { 0.999981175f, -0.00613588465f }, { 0.999957645f, -0.00920375478f },
+    { 0.999924702f, -0.0122715383f }, { 0.999882347f, -0.0153392063f }, { 0.999830582f, -0.0184067299f }, { 0.999769405f, -0.0214740803f },
+    { 0.999698819f, -0.0245412285f }, { 0.999618822f, -0.0276081458f }, { 0.999529418f, -0.0306748032f }, { 0.999430605f, -0.0337411719f },
+    { 0.999322385f, -0.0368072229f }, { 0.999204759f, -0.0398729276f }, { 0.999077728f, -0.0429382569f }, { 0.998941293f, -0.0460031821f },
+    { 0.998795456f, -0.0490676743f }, { 0.998640218f, -0.0521317047f }, { 0.998475581f, -0.0551952443f }, { 0.998301545f, -0.0582582645f },
+    { 0.998118113f, -0.0613207363f }, { 0.997925286f, -0.0643826309f }, { 0.997723067f, -0.0674439196f }, { 0.997511456f, -0.0705045734f },
+    { 0.997290457f, -0.0735645636f }, { 0.99706007f, -0.0766238614f }, { 0.996820299f, -0.079682438f }, { 0.996571146f, -0.0827402645f },
+    { 0.996312612f, -0.0857973123f }, { 0.996044701f, -0.0888535526f }, { 0.995767414f, -0.0919089565f }, { 0.995480755f, -0.0949634953f },
+    { 0.995184727f, -0.0980171403f }, { 0.994879331f, -0.101069863f }, { 0.994564571f, -0.104121634f }, { 0.994240449f, -0.107172425f },
+    { 0.99390697f, -0.110222207f }, { 0.993564136f, -0.113270952f }, { 0.993211949f, -0.116318631f }, { 0.992850414f, -0.119365215f },
+    { 0.992479535f, -0.122410675f }, { 0.992099313f, -0.125454983f }, { 0.991709754f, -0.128498111f }, { 0.99131086f, -0.131540029f },
+    { 0.990902635f, -0.134580709f }, { 0.990485084f, -0.137620122f }, { 0.99005821f, -0.140658239f }, { 0.989622017f, -0.143695033f },
+    { 0.98917651f, -0.146730474f }, { 0.988721692f, -0.149764535f }, { 0.988257568f, -0.152797185f }, { 0.987784142f, -0.155828398f },
+    { 0.987301418f, -0.158858143f }, { 0.986809402f, -0.161886394f }, { 0.986308097f, -0.16491312f }, { 0.985797509f, -0.167938295f },
+    { 0.985277642f, -0.170961889f }, { 0.984748502f, -0.173983873f }, { 0.984210092f, -0.17700422f }, { 0.983662419f, -0.180022901f },
+    { 0.983105487f, -0.183039888f }, { 0.982539302f, -0.186055152f }, { 0.981963869f, -0.189068664f }, { 0.981379193f, -0.192080397f },
+    { 0.98078528f, -0.195090322f }, { 0.980182136f, -0.198098411f }, { 0.979569766f, -0.201104635f }, { 0.978948175f, -0.204108966f },
+    { 0.978317371f, -0.207111376f }, { 0.977677358f, -0.210111837f }, { 0.977028143f, -0.21311032f }, { 0.976369731f, -0.216106797f },
+    { 0.97570213f, -0.21910124f }, { 0.975025345f, -0.222093621f }, { 0.974339383f, -0.225083911f }, { 0.97364425f, -0.228072083f },
+    { 0.972939952f, -0.231058108f }, { 0.972226497f, -0.234041959f }, { 0.971503891f, -0.237023606f }, { 0.970772141f, -0.240003022f },
+    { 0.970031253f, -0.24298018f }, { 0.969281235f, -0.24595505f }, { 0.968522094f, -0.248927606f }, { 0.967753837f, -0.251897818f },
+    { 0.966976471f, -0.25486566f }, { 0.966190003f, -0.257831102f }, { 0.965394442f, -0.260794118f }, { 0.964589793f, -0.263754679f },
+    { 0.963776066f, -0.266712757f }, { 0.962953267f, -0.269668326f }, { 0.962121404f, -0.272621355f }, { 0.961280486f, -0.275571819f },
+    { 0.960430519f, -0.278519689f }, { 0.959571513f, -0.281464938f }, { 0.958703475f, -0.284407537f }, { 0.957826413f, -0.28734746f },
+    { 0.956940336f, -0.290284677f }, { 0.956045251f, -0.293219163f }, { 0.955141168f, -0.296150888f }, { 0.954228095f, -0.299079826f },
+    { 0.95330604f, -0.302005949f }, { 0.952375013f, -0.30492923f }, { 0.951435021f, -0.30784964f }, { 0.950486074f, -0.310767153f },
+    { 0.949528181f, -0.31368174f }, { 0.94856135f, -0.316593376f }, { 0.947585591f, -0.319502031f }, { 0.946600913f, -0.322407679f },
+    { 0.945607325f, -0.325310292f }, { 0.944604837f, -0.328209844f }, { 0.943593458f, -0.331106306f }, { 0.942573198f, -0.333999651f },
+    { 0.941544065f, -0.336889853f }, { 0.940506071f, -0.339776884f }, { 0.939459224f, -0.342660717f }, { 0.938403534f, -0.345541325f },
+    { 0.937339012f, -0.34841868f }, { 0.936265667f, -0.351292756f }, { 0.93518351f, -0.354163525f }, { 0.93409255f, -0.357030961f },
+    { 0.932992799f, -0.359895037f }, { 0.931884266f, -0.362755724f }, { 0.930766961f, -0.365612998f }, { 0.929640896f, -0.36846683f },
+    { 0.92850608f, -0.371317194f }, { 0.927362526f, -0.374164063f }, { 0.926210242f, -0.37700741f }, { 0.925049241f, -0.379847209f },
+    { 0.923879533f, -0.382683432f }, { 0.922701128f, -0.385516054f }, { 0.921514039f, -0.388345047f }, { 0.920318277f, -0.391170384f },
+    { 0.919113852f, -0.39399204f }, { 0.917900776f, -0.396809987f }, { 0.91667906f, -0.3996242f }, { 0.915448716f, -0.402434651f },
+    { 0.914209756f, -0.405241314f }, { 0.91296219f, -0.408044163f }, { 0.911706032f, -0.410843171f }, { 0.910441292f, -0.413638312f },
+    { 0.909167983f, -0.41642956f }, { 0.907886116f, -0.419216888f }, { 0.906595705f, -0.422000271f }, { 0.905296759f, -0.424779681f },
+    { 0.903989293f, -0.427555093f }, { 0.902673318f, -0.430326481f }, { 0.901348847f, -0.433093819f }, { 0.900015892f, -0.43585708f },
+    { 0.898674466f, -0.438616239f }, { 0.897324581f, -0.441371269f }, { 0.89596625f, -0.444122145f }, { 0.894599486f, -0.44686884f },
+    { 0.893224301f, -0.44961133f }, { 0.891840709f, -0.452349587f }, { 0.890448723f, -0.455083587f }, { 0.889048356f, -0.457813304f },
+    { 0.88763962f, -0.460538711f }, { 0.88622253f, -0.463259784f }, { 0.884797098f, -0.465976496f }, { 0.883363339f, -0.468688822f },
+    { 0.881921264f, -0.471396737f }, { 0.880470889f, -0.474100215f }, { 0.879012226f, -0.47679923f }, { 0.87754529f, -0.479493758f },
+    { 0.876070094f, -0.482183772f }, { 0.874586652f, -0.484869248f }, { 0.873094978f, -0.48755016f }, { 0.871595087f, -0.490226483f },
+    { 0.870086991f, -0.492898192f }, { 0.868570706f, -0.495565262f }, { 0.867046246f, -0.498227667f }, { 0.865513624f, -0.500885383f },
+    { 0.863972856f, -0.503538384f }, { 0.862423956f, -0.506186645f }, { 0.860866939f, -0.508830143f }, { 0.859301818f, -0.51146885f },
+    { 0.85772861f, -0.514102744f }, { 0.856147328f, -0.516731799f }, { 0.854557988f, -0.51935599f }, { 0.852960605f, -0.521975293f },
+    { 0.851355193f, -0.524589683f }, { 0.849741768f, -0.527199135f }, { 0.848120345f, -0.529803625f }, { 0.846490939f, -0.532403128f },
+    { 0.844853565f, -0.53499762f }, { 0.84320824f, -0.537587076f }, { 0.841554977f, -0.540171473f }, { 0.839893794f, -0.542750785f },
+    { 0.838224706f, -0.545324988f }, { 0.836547727f, -0.547894059f }, { 0.834862875f, -0.550457973f }, { 0.833170165f, -0.553016706f },
+    { 0.831469612f, -0.555570233f }, { 0.829761234f, -0.558118531f }, { 0.828045045f, -0.560661576f }, { 0.826321063f, -0.563199344f },
+    { 0.824589303f, -0.565731811f }, { 0.822849781f, -0.568258953f }, { 0.821102515f, -0.570780746f }, { 0.81934752f, -0.573297167f },
+    { 0.817584813f, -0.575808191f }, { 0.815814411f, -0.578313796f }, { 0.81403633f, -0.580813958f }, { 0.812250587f, -0.583308653f },
+    { 0.810457198f, -0.585797857f }, { 0.808656182f, -0.588281548f }, { 0.806847554f, -0.590759702f }, { 0.805031331f, -0.593232295f },
+    { 0.803207531f, -0.595699304f }, { 0.801376172f, -0.598160707f }, { 0.799537269f, -0.600616479f }, { 0.797690841f, -0.603066599f },
+    { 0.795836905f, -0.605511041f }, { 0.793975478f, -0.607949785f }, { 0.792106577f, -0.610382806f }, { 0.790230221f, -0.612810082f },
+    { 0.788346428f, -0.615231591f }, { 0.786455214f, -0.617647308f }, { 0.784556597f, -0.620057212f }, { 0.782650596f, -0.622461279f },
+    { 0.780737229f, -0.624859488f }, { 0.778816512f, -0.627251815f }, { 0.776888466f, -0.629638239f }, { 0.774953107f, -0.632018736f },
+    { 0.773010453f, -0.634393284f }, { 0.771060524f, -0.636761861f }, { 0.769103338f, -0.639124445f }, { 0.767138912f, -0.641481013f },
+    { 0.765167266f, -0.643831543f }, { 0.763188417f, -0.646176013f }, { 0.761202385f, -0.648514401f }, { 0.759209189f, -0.650846685f },
+    { 0.757208847f, -0.653172843f }, { 0.755201377f, -0.655492853f }, { 0.753186799f, -0.657806693f }, { 0.751165132f, -0.660114342f },
+    { 0.749136395f, -0.662415778f }, { 0.747100606f, -0.664710978f }, { 0.745057785f, -0.666999922f }, { 0.743007952f, -0.669282588f },
+    { 0.740951125f, -0.671558955f }, { 0.738887324f, -0.673829f }, { 0.736816569f, -0.676092704f }, { 0.734738878f, -0.678350043f },
+    { 0.732654272f, -0.680600998f }, { 0.730562769f, -0.682845546f }, { 0.72846439f, -0.685083668f }, { 0.726359155f, -0.687315341f },
+    { 0.724247083f, -0.689540545f }, { 0.722128194f, -0.691759258f }, { 0.720002508f, -0.693971461f }, { 0.717870045f, -0.696177131f },
+    { 0.715730825f, -0.698376249f }, { 0.713584869f, -0.700568794f }, { 0.711432196f, -0.702754744f }, { 0.709272826f, -0.70493408f },
+    { 0.707106781f, -0.707106781f }, { 0.70493408f, -0.709272826f }, { 0.702754744f, -0.711432196f }, { 0.700568794f, -0.713584869f },
+    { 0.698376249f, -0.715730825f }, { 0.696177131f, -0.717870045f }, { 0.693971461f, -0.720002508f }, { 0.691759258f, -0.722128194f },
+    { 0.689540545f, -0.724247083f }, { 0.687315341f, -0.726359155f }, { 0.685083668f, -0.72846439f }, { 0.682845546f, -0.730562769f },
+    { 0.680600998f, -0.732654272f }, { 0.678350043f, -0.734738878f }, { 0.676092704f, -0.736816569f }, { 0.673829f, -0.738887324f },
+    { 0.671558955f, -0.740951125f }, { 0.669282588f, -0.743007952f }, { 0.666999922f, -0.745057785f }, { 0.664710978f, -0.747100606f },
+    { 0.662415778f, -0.749136395f }, { 0.660114342f, -0.751165132f }, { 0.657806693f, -0.753186799f }, { 0.655492853f, -0.755201377f },
+    { 0.653172843f, -0.757208847f }, { 0.650846685f, -0.759209189f }, { 0.648514401f, -0.761202385f }, { 0.646176013f, -0.763188417f },
+    { 0.643831543f, -0.765167266f }, { 0.641481013f, -0.767138912f }, { 0.639124445f, -0.769103338f }, { 0.636761861f, -0.771060524f },
+    { 0.634393284f, -0.773010453f }, { 0.632018736f, -0.774953107f }, { 0.629638239f, -0.776888466f }, { 0.627251815f, -0.778816512f },
+    { 0.624859488f, -0.780737229f }, { 0.622461279f, -0.782650596f }, { 0.620057212f, -0.784556597f }, { 0.617647308f, -0.786455214f },
+    { 0.615231591f, -0.788346428f }, { 0.612810082f, -0.790230221f }, { 0.610382806f, -0.792106577f }, { 0.607949785f, -0.793975478f },
+    { 0.605511041f, -0.795836905f }, { 0.603066599f, -0.797690841f }, { 0.600616479f, -0.799537269f }, { 0.598160707f, -0.801376172f },
+    { 0.595699304f, -0.803207531f }, { 0.593232295f, -0.805031331f }, { 0.590759702f, -0.806847554f }, { 0.588281548f, -0.808656182f },
+    { 0.585797857f, -0.810457198f }, { 0.583308653f, -0.812250587f }, { 0.580813958f, -0.81403633f }, { 0.578313796f, -0.815814411f },
+    { 0.575808191f, -0.817584813f }, { 0.573297167f, -0.81934752f }, { 0.570780746f, -0.821102515f }, { 0.568258953f, -0.822849781f },
+    { 0.565731811f, -0.824589303f }, { 0.563199344f, -0.826321063f }, { 0.560661576f, -0.828045045f }, { 0.558118531f, -0.829761234f },
+    { 0.555570233f, -0.831469612f }, { 0.553016706f, -0.833170165f }, { 0.550457973f, -0.834862875f }, { 0.547894059f, -0.836547727f },
+    { 0.545324988f, -0.838224706f }, { 0.542750785f, -0.839893794f }, { 0.540171473f, -0.841554977f }, { 0.537587076f, -0.84320824f },
+    { 0.53499762f, -0.844853565f }, { 0.532403128f, -0.846490939f }, { 0.529803625f, -0.848120345f }, { 0.527199135f, -0.849741768f },
+    { 0.524589683f, -0.851355193f }, { 0.521975293f, -0.852960605f }, { 0.51935599f, -0.854557988f }, { 0.516731799f, -0.856147328f },
+    { 0.514102744f, -0.85772861f }, { 0.51146885f, -0.859301818f }, { 0.508830143f, -0.860866939f }, { 0.506186645f, -0.862423956f },
+    { 0.503538384f, -0.863972856f }, { 0.500885383f, -0.865513624f }, { 0.498227667f, -0.867046246f }, { 0.495565262f, -0.868570706f },
+    { 0.492898192f, -0.870086991f }, { 0.490226483f, -0.871595087f }, { 0.48755016f, -0.873094978f }, { 0.484869248f, -0.874586652f },
+    { 0.482183772f, -0.876070094f }, { 0.479493758f, -0.87754529f }, { 0.47679923f, -0.879012226f }, { 0.474100215f, -0.880470889f },
+    { 0.471396737f, -0.881921264f }, { 0.468688822f, -0.883363339f }, { 0.465976496f, -0.884797098f }, { 0.463259784f, -0.88622253f },
+    { 0.460538711f, -0.88763962f }, { 0.457813304f, -0.889048356f }, { 0.455083587f, -0.890448723f }, { 0.452349587f, -0.891840709f },
+    { 0.44961133f, -0.893224301f }, { 0.44686884f, -0.894599486f }, { 0.444122145f, -0.89596625f }, { 0.441371269f, -0.897324581f },
+    { 0.438616239f, -0.898674466f }, { 0.43585708f, -0.900015892f }, { 0.433093819f, -0.901348847f }, { 0.430326481f, -0.902673318f },
+    { 0.427555093f, -0.903989293f }, { 0.424779681f, -0.905296759f }, { 0.422000271f, -0.906595705f }, { 0.419216888f, -0.907886116f },
+    { 0.41642956f, -0.909167983f }, { 0.413638312f, -0.910441292f }, { 0.410843171f, -0.911706032f }, { 0.408044163f, -0.91296219f },
+    { 0.405241314f, -0.914209756f }, { 0.402434651f, -0.915448716f }, { 0.3996242f, -0.91667906f }, { 0.396809987f, -0.917900776f },
+    { 0.39399204f, -0.919113852f }, { 0.391170384f, -0.920318277f }, { 0.388345047f, -0.921514039f }, { 0.385516054f, -0.922701128f },
+    { 0.382683432f, -0.923879533f }, { 0.379847209f, -0.925049241f }, { 0.37700741f, -0.926210242f }, { 0.374164063f, -0.927362526f },
+    { 0.371317194f, -0.92850608f }, { 0.36846683f, -0.929640896f }, { 0.365612998f, -0.930766961f }, { 0.362755724f, -0.931884266f },
+    { 0.359895037f, -0.932992799f }, { 0.357030961f, -0.93409255f }, { 0.354163525f, -0.93518351f }, { 0.351292756f, -0.936265667f },
+    { 0.34841868f, -0.937339012f }, { 0.345541325f, -0.938403534f }, { 0.342660717f, -0.939459224f }, { 0.339776884f, -0.940506071f },
+    { 0.336889853f, -0.941544065f }, { 0.333999651f, -0.942573198f }, { 0.331106306f, -0.943593458f }, { 0.328209844f, -0.944604837f },
+    { 0.325310292f, -0.945607325f }, { 0.322407679f, -0.946600913f }, { 0.319502031f, -0.947585591f }, { 0.316593376f, -0.94856135f },
+    { 0.31368174f, -0.949528181f }, { 0.310767153f, -0.950486074f }, { 0.30784964f, -0.951435021f }, { 0.30492923f, -0.952375013f },
+    { 0.302005949f, -0.95330604f }, { 0.299079826f, -0.954228095f }, { 0.296150888f, -0.955141168f }, { 0.293219163f, -0.956045251f },
+    { 0.290284677f, -0.956940336f }, { 0.28734746f, -0.957826413f }, { 0.284407537f, -0.958703475f }, { 0.281464938f, -0.959571513f },
+    { 0.278519689f, -0.960430519f }, { 0.275571819f, -0.961280486f }, { 0.272621355f, -0.962121404f }, { 0.269668326f, -0.962953267f },
+    { 0.266712757f, -0.963776066f }, { 0.263754679f, -0.964589793f }, { 0.260794118f, -0.965394442f }, { 0.257831102f, -0.966190003f },
+    { 0.25486566f, -0.966976471f }, { 0.251897818f, -0.967753837f }, { 0.248927606f, -0.968522094f }, { 0.24595505f, -0.969281235f },
+    { 0.24298018f, -0.970031253f }, { 0.240003022f, -0.970772141f }, { 0.237023606f, -0.971503891f }, { 0.234041959f, -0.972226497f },
+    { 0.231058108f, -0.972939952f }, { 0.228072083f, -0.97364425f }, { 0.225083911f, -0.974339383f }, { 0.222093621f, -0.975025345f },
+    { 0.21910124f, -0.97570213f }, { 0.216106797f, -0.976369731f }, { 0.21311032f, -0.977028143f }, { 0.210111837f, -0.977677358f },
+    { 0.207111376f, -0.978317371f }, { 0.204108966f, -0.978948175f }, { 0.201104635f, -0.979569766f }, { 0.198098411f, -0.980182136f },
+    { 0.195090322f, -0.98078528f }, { 0.192080397f, -0.981379193f }, { 0.189068664f, -0.981963869f }, { 0.186055152f, -0.982539302f },
+    { 0.183039888f, -0.983105487f }, { 0.180022901f, -0.983662419f }, { 0.17700422f, -0.984210092f }, { 0.173983873f, -0.984748502f },
+    { 0.170961889f, -0.985277642f }, { 0.167938295f, -0.985797509f }, { 0.16491312f, -0.986308097f }, { 0.161886394f, -0.986809402f },
+    { 0.158858143f, -0.987301418f }, { 0.155828398f, -0.987784142f }, { 0.152797185f, -0.988257568f }, { 0.149764535f, -0.988721692f },
+    { 0.146730474f, -0.98917651f }, { 0.143695033f, -0.989622017f }, { 0.140658239f, -0.99005821f }, { 0.137620122f, -0.990485084f },
+    { 0.134580709f, -0.990902635f }, { 0.131540029f, -0.99131086f }, { 0.128498111f, -0.991709754f }, { 0.125454983f, -0.992099313f },
+    { 0.122410675f, -0.992479535f }, { 0.119365215f, -0.992850414f }, { 0.116318631f, -0.993211949f }, { 0.113270952f, -0.993564136f },
+    { 0.110222207f, -0.99390697f }, { 0.107172425f, -0.994240449f }, { 0.104121634f, -0.994564571f }, { 0.101069863f, -0.994879331f },
+    { 0.0980171403f, -0.995184727f }, { 0.0949634953f, -0.995480755f }, { 0.0919089565f, -0.995767414f }, { 0.0888535526f, -0.996044701f },
+    { 0.0857973123f, -0.996312612f }, { 0.0827402645f, -0.996571146f }, { 0.079682438f, -0.996820299f }, { 0.0766238614f, -0.99706007f },
+    { 0.0735645636f, -0.997290457f }, { 0.0705045734f, -0.997511456f }, { 0.0674439196f, -0.997723067f }, { 0.0643826309f, -0.997925286f },
+    { 0.0613207363f, -0.998118113f }, { 0.0582582645f, -0.998301545f }, { 0.0551952443f, -0.998475581f }, { 0.0521317047f, -0.998640218f },
+    { 0.0490676743f, -0.998795456f }, { 0.0460031821f, -0.998941293f }, { 0.0429382569f, -0.999077728f }, { 0.0398729276f, -0.999204759f },
+    { 0.0368072229f, -0.999322385f }, { 0.0337411719f, -0.999430605f }, { 0.0306748032f, -0.999529418f }, { 0.0276081458f, -0.999618822f },
+    { 0.0245412285f, -0.999698819f }, { 0.0214740803f, -0.999769405f }, { 0.0184067299f, -0.999830582f }, { 0.0153392063f, -0.999882347f },
+    { 0.0122715383f, -0.999924702f }, { 0.00920375478f, -0.999957645f }, { 0.00613588465f, -0.999981175f }, { 0.00306795676f, -0.999995294f },
+    { 6.123234e-17f, -1.0f }, { -0.00306795676f, -0.999995294f }, { -0.00613588465f, -0.999981175f }, { -0.00920375478f, -0.999957645f },
+    { -0.0122715383f, -0.999924702f }, { -0.0153392063f, -0.999882347f }, { -0.0184067299f, -0.999830582f }, { -0.0214740803f, -0.999769405f },
+    { -0.0245412285f, -0.999698819f }, { -0.0276081458f, -0.999618822f }, { -0.0306748032f, -0.999529418f }, { -0.0337411719f, -0.999430605f },
+    { -0.0368072229f, -0.999322385f }, { -0.0398729276f, -0.999204759f }, { -0.0429382569f, -0.999077728f }, { -0.0460031821f, -0.998941293f },
+    { -0.0490676743f, -0.998795456f }, { -0.0521317047f, -0.998640218f }, { -0.0551952443f, -0.998475581f }, { -0.0582582645f, -0.998301545f },
+    { -0.0613207363f, -0.998118113f }, { -0.0643826309f, -0.997925286f }, { -0.0674439196f, -0.997723067f }, { -0.0705045734f, -0.997511456f },
+    { -0.0735645636f, -0.997290457f }, { -0.0766238614f, -0.99706007f }, { -0.079682438f, -0.996820299f }, { -0.0827402645f, -0.996571146f },
+    { -0.0857973123f, -0.996312612f }, { -0.0888535526f, -0.996044701f }, { -0.0919089565f, -0.995767414f }, { -0.0949634953f, -0.995480755f },
+    { -0.0980171403f, -0.995184727f }, { -0.101069863f, -0.994879331f }, { -0.104121634f, -0.994564571f }, { -0.107172425f, -0.994240449f },
+    { -0.110222207f, -0.99390697f }, { -0.113270952f, -0.993564136f }, { -0.116318631f, -0.993211949f }, { -0.119365215f, -0.992850414f },
+    { -0.122410675f, -0.992479535f }, { -0.125454983f, -0.992099313f }, { -0.128498111f, -0.991709754f }, { -0.131540029f, -0.99131086f },
+    { -0.134580709f, -0.990902635f }, { -0.137620122f, -0.990485084f }, { -0.140658239f, -0.99005821f }, { -0.143695033f, -0.989622017f },
+    { -0.146730474f, -0.98917651f }, { -0.149764535f, -0.988721692f }, { -0.152797185f, -0.988257568f }, { -0.155828398f, -0.987784142f },
+    { -0.158858143f, -0.987301418f }, { -0.161886394f, -0.986809402f }, { -0.16491312f, -0.986308097f }, { -0.167938295f, -0.985797509f },
+    { -0.170961889f, -0.985277642f }, { -0.173983873f, -0.984748502f }, { -0.17700422f, -0.984210092f }, { -0.180022901f, -0.983662419f },
+    { -0.183039888f, -0.983105487f }, { -0.186055152f, -0.982539302f }, { -0.189068664f, -0.981963869f }, { -0.192080397f, -0.981379193f },
+    { -0.195090322f, -0.98078528f }, { -0.198098411f, -0.980182136f }, { -0.201104635f, -0.979569766f }, { -0.204108966f, -0.978948175f },
+    { -0.207111376f, -0.978317371f }, { -0.210111837f, -0.977677358f }, { -0.21311032f, -0.977028143f }, { -0.216106797f, -0.976369731f },
+    { -0.21910124f, -0.97570213f }, { -0.222093621f, -0.975025345f }, { -0.225083911f, -0.974339383f }, { -0.228072083f, -0.97364425f },
+    { -0.231058108f, -0.972939952f }, { -0.234041959f, -0.972226497f }, { -0.237023606f, -0.971503891f }, { -0.240003022f, -0.970772141f },
+    { -0.24298018f, -0.970031253f }, { -0.24595505f, -0.969281235f }, { -0.248927606f, -0.968522094f }, { -0.251897818f, -0.967753837f },
+    { -0.25486566f, -0.966976471f }, { -0.257831102f, -0.966190003f }, { -0.260794118f, -0.965394442f }, { -0.263754679f, -0.964589793f },
+    { -0.266712757f, -0.963776066f }, { -0.269668326f, -0.962953267f }, { -0.272621355f, -0.962121404f }, { -0.275571819f, -0.961280486f },
+    { -0.278519689f, -0.960430519f }, { -0.281464938f, -0.959571513f }, { -0.284407537f, -0.958703475f }, { -0.28734746f, -0.957826413f },
+    { -0.290284677f, -0.956940336f }, { -0.293219163f, -0.956045251f }, { -0.296150888f, -0.955141168f }, { -0.299079826f, -0.954228095f },
+    { -0.302005949f, -0.95330604f }, { -0.30492923f, -0.952375013f }, { -0.30784964f, -0.951435021f }, { -0.310767153f, -0.950486074f },
+    { -0.31368174f, -0.949528181f }, { -0.316593376f, -0.94856135f }, { -0.319502031f, -0.947585591f }, { -0.322407679f, -0.946600913f },
+    { -0.325310292f, -0.945607325f }, { -0.328209844f, -0.944604837f }, { -0.331106306f, -0.943593458f }, { -0.333999651f, -0.942573198f },
+    { -0.336889853f, -0.941544065f }, { -0.339776884f, -0.940506071f }, { -0.342660717f, -0.939459224f }, { -0.345541325f, -0.938403534f },
+    { -0.34841868f, -0.937339012f }, { -0.351292756f, -0.936265667f }, { -0.354163525f, -0.93518351f }, { -0.357030961f, -0.93409255f },
+    { -0.359895037f, -0.932992799f }, { -0.362755724f, -0.931884266f }, { -0.365612998f, -0.930766961f }, { -0.36846683f, -0.929640896f },
+    { -0.371317194f, -0.92850608f }, { -0.374164063f, -0.927362526f }, { -0.37700741f, -0.926210242f }, { -0.379847209f, -0.925049241f },
+    { -0.382683432f, -0.923879533f }, { -0.385516054f, -0.922701128f }, { -0.388345047f, -0.921514039f }, { -0.391170384f, -0.920318277f },
+    { -0.39399204f, -0.919113852f }, { -0.396809987f, -0.917900776f }, { -0.3996242f, -0.91667906f }, { -0.402434651f, -0.915448716f },
+    { -0.405241314f, -0.914209756f }, { -0.408044163f, -0.91296219f }, { -0.410843171f, -0.911706032f }, { -0.413638312f, -0.910441292f },
+    { -0.41642956f, -0.909167983f }, { -0.419216888f, -0.907886116f }, { -0.422000271f, -0.906595705f }, { -0.424779681f, -0.905296759f },
+    { -0.427555093f, -0.903989293f }, { -0.430326481f, -0.902673318f }, { -0.433093819f, -0.901348847f }, { -0.43585708f, -0.900015892f },
+    { -0.438616239f, -0.898674466f }, { -0.441371269f, -0.897324581f }, { -0.444122145f, -0.89596625f }, { -0.44686884f, -0.894599486f },
+    { -0.44961133f, -0.893224301f }, { -0.452349587f, -0.891840709f }, { -0.455083587f, -0.890448723f }, { -0.457813304f, -0.889048356f },
+    { -0.460538711f, -0.88763962f }, { -0.463259784f, -0.88622253f }, { -0.465976496f, -0.884797098f }, { -0.468688822f, -0.883363339f },
+    { -0.471396737f, -0.881921264f }, { -0.474100215f, -0.880470889f }, { -0.47679923f, -0.879012226f }, { -0.479493758f, -0.87754529f },
+    { -0.482183772f, -0.876070094f }, { -0.484869248f, -0.874586652f }, { -0.48755016f, -0.873094978f }, { -0.490226483f, -0.871595087f },
+    { -0.492898192f, -0.870086991f }, { -0.495565262f, -0.868570706f }, { -0.498227667f, -0.867046246f }, { -0.500885383f, -0.865513624f },
+    { -0.503538384f, -0.863972856f }, { -0.506186645f, -0.862423956f }, { -0.508830143f, -0.860866939f }, { -0.51146885f, -0.859301818f },
+    { -0.514102744f, -0.85772861f }, { -0.516731799f, -0.856147328f }, { -0.51935599f, -0.854557988f }, { -0.521975293f, -0.852960605f },
+    { -0.524589683f, -0.851355193f }, { -0.527199135f, -0.849741768f }, { -0.529803625f, -0.848120345f }, { -0.532403128f, -0.846490939f },
+    { -0.53499762f, -0.844853565f }, { -0.537587076f, -0.84320824f }, { -0.540171473f, -0.841554977f }, { -0.542750785f, -0.839893794f },
+    { -0.545324988f, -0.838224706f }, { -0.547894059f, -0.836547727f }, { -0.550457973f, -0.834862875f }, { -0.553016706f, -0.833170165f },
+    { -0.555570233f, -0.831469612f }, { -0.558118531f, -0.829761234f }, { -0.560661576f, -0.828045045f }, { -0.563199344f, -0.826321063f },
+    { -0.565731811f, -0.824589303f }, { -0.568258953f, -0.822849781f }, { -0.570780746f, -0.821102515f }, { -0.573297167f, -0.81934752f },
+    { -0.575808191f, -0.817584813f }, { -0.578313796f, -0.815814411f }, { -0.580813958f, -0.81403633f }, { -0.583308653f, -0.812250587f },
+    { -0.585797857f, -0.810457198f }, { -0.588281548f, -0.808656182f }, { -0.590759702f, -0.806847554f }, { -0.593232295f, -0.805031331f },
+    { -0.595699304f, -0.803207531f }, { -0.598160707f, -0.801376172f }, { -0.600616479f, -0.799537269f }, { -0.603066599f, -0.797690841f },
+    { -0.605511041f, -0.795836905f }, { -0.607949785f, -0.793975478f }, { -0.610382806f, -0.792106577f }, { -0.612810082f, -0.790230221f },
+    { -0.615231591f, -0.788346428f }, { -0.617647308f, -0.786455214f }, { -0.620057212f, -0.784556597f }, { -0.622461279f, -0.782650596f },
+    { -0.624859488f, -0.780737229f }, { -0.627251815f, -0.778816512f }, { -0.629638239f, -0.776888466f }, { -0.632018736f, -0.774953107f },
+    { -0.634393284f, -0.773010453f }, { -0.636761861f, -0.771060524f }, { -0.639124445f, -0.769103338f }, { -0.641481013f, -0.767138912f },
+    { -0.643831543f, -0.765167266f }, { -0.646176013f, -0.763188417f }, { -0.648514401f, -0.761202385f }, { -0.650846685f, -0.759209189f },
+    { -0.653172843f, -0.757208847f }, { -0.655492853f, -0.755201377f }, { -0.657806693f, -0.753186799f }, { -0.660114342f, -0.751165132f },
+    { -0.662415778f, -0.749136395f }, { -0.664710978f, -0.747100606f }, { -0.666999922f, -0.745057785f }, { -0.669282588f, -0.743007952f },
+    { -0.671558955f, -0.740951125f }, { -0.673829f, -0.738887324f }, { -0.676092704f, -0.736816569f }, { -0.678350043f, -0.734738878f },
+    { -0.680600998f, -0.732654272f }, { -0.682845546f, -0.730562769f }, { -0.685083668f, -0.72846439f }, { -0.687315341f, -0.726359155f },
+    { -0.689540545f, -0.724247083f }, { -0.691759258f, -0.722128194f }, { -0.693971461f, -0.720002508f }, { -0.696177131f, -0.717870045f },
+    { -0.698376249f, -0.715730825f }, { -0.700568794f, -0.713584869f }, { -0.702754744f, -0.711432196f }, { -0.70493408f, -0.709272826f },
+    { -0.707106781f, -0.707106781f }, { -0.709272826f, -0.70493408f }, { -0.711432196f, -0.702754744f }, { -0.713584869f, -0.700568794f },
+    { -0.715730825f, -0.698376249f }, { -0.717870045f, -0.696177131f }, { -0.720002508f, -0.693971461f }, { -0.722128194f, -0.691759258f },
+    { -0.724247083f, -0.689540545f }, { -0.726359155f, -0.687315341f }, { -0.72846439f, -0.685083668f }, { -0.730562769f, -0.682845546f },
+    { -0.732654272f, -0.680600998f }, { -0.734738878f, -0.678350043f }, { -0.736816569f, -0.676092704f }, { -0.738887324f, -0.673829f },
+    { -0.740951125f, -0.671558955f }, { -0.743007952f, -0.669282588f }, { -0.745057785f, -0.666999922f }, { -0.747100606f, -0.664710978f },
+    { -0.749136395f, -0.662415778f }, { -0.751165132f, -0.660114342f }, { -0.753186799f, -0.657806693f }, { -0.755201377f, -0.655492853f },
+    { -0.757208847f, -0.653172843f }, { -0.759209189f, -0.650846685f }, { -0.761202385f, -0.648514401f }, { -0.763188417f, -0.646176013f },
+    { -0.765167266f, -0.643831543f }, { -0.767138912f, -0.641481013f }, { -0.769103338f, -0.639124445f }, { -0.771060524f, -0.636761861f },
+    { -0.773010453f, -0.634393284f }, { -0.774953107f, -0.632018736f }, { -0.776888466f, -0.629638239f }, { -0.778816512f, -0.627251815f },
+    { -0.780737229f, -0.624859488f }, { -0.782650596f, -0.622461279f }, { -0.784556597f, -0.620057212f }, { -0.786455214f, -0.617647308f },
+    { -0.788346428f, -0.615231591f }, { -0.790230221f, -0.612810082f }, { -0.792106577f, -0.610382806f }, { -0.793975478f, -0.607949785f },
+    { -0.795836905f, -0.605511041f }, { -0.797690841f, -0.603066599f }, { -0.799537269f, -0.600616479f }, { -0.801376172f, -0.598160707f },
+    { -0.803207531f, -0.595699304f }, { -0.805031331f, -0.593232295f }, { -0.806847554f, -0.590759702f }, { -0.808656182f, -0.588281548f },
+    { -0.810457198f, -0.585797857f }, { -0.812250587f, -0.583308653f }, { -0.81403633f, -0.580813958f }, { -0.815814411f, -0.578313796f },
+    { -0.817584813f, -0.575808191f }, { -0.81934752f, -0.573297167f }, { -0.821102515f, -0.570780746f }, { -0.822849781f, -0.568258953f },
+    { -0.824589303f, -0.565731811f }, { -0.826321063f, -0.563199344f }, { -0.828045045f, -0.560661576f }, { -0.829761234f, -0.558118531f },
+    { -0.831469612f, -0.555570233f }, { -0.833170165f, -0.553016706f }, { -0.834862875f, -0.550457973f }, { -0.836547727f, -0.547894059f },
+    { -0.838224706f, -0.545324988f }, { -0.839893794f, -0.542750785f }, { -0.841554977f, -0.540171473f }, { -0.84320824f, -0.537587076f },
+    { -0.844853565f, -0.53499762f }, { -0.846490939f, -0.532403128f }, { -0.848120345f, -0.529803625f }, { -0.849741768f, -0.527199135f },
+    { -0.851355193f, -0.524589683f }, { -0.852960605f, -0.521975293f }, { -0.854557988f, -0.51935599f }, { -0.856147328f, -0.516731799f },
+    { -0.85772861f, -0.514102744f }, { -0.859301818f, -0.51146885f }, { -0.860866939f, -0.508830143f }, { -0.862423956f, -0.506186645f },
+    { -0.863972856f, -0.503538384f }, { -0.865513624f, -0.500885383f }, { -0.867046246f, -0.498227667f }, { -0.868570706f, -0.495565262f },
+    { -0.870086991f, -0.492898192f }, { -0.871595087f, -0.490226483f }, { -0.873094978f, -0.48755016f }, { -0.874586652f, -0.484869248f },
+    { -0.876070094f, -0.482183772f }, { -0.87754529f, -0.479493758f }, { -0.879012226f, -0.47679923f }, { -0.880470889f, -0.474100215f },
+    { -0.881921264f, -0.471396737f }, { -0.883363339f, -0.468688822f }, { -0.884797098f, -0.465976496f }, { -0.88622253f, -0.463259784f },
+    { -0.88763962f, -0.460538711f }, { -0.889048356f, -0.457813304f }, { -0.890448723f, -0.455083587f }, { -0.891840709f, -0.452349587f },
+    { -0.893224301f, -0.44961133f }, { -0.894599486f, -0.44686884f }, { -0.89596625f, -0.444122145f }, { -0.897324581f, -0.441371269f },
+    { -0.898674466f, -0.438616239f }, { -0.900015892f, -0.43585708f }, { -0.901348847f, -0.433093819f }, { -0.902673318f, -0.430326481f },
+    { -0.903989293f, -0.427555093f }, { -0.905296759f, -0.424779681f }, { -0.906595705f, -0.422000271f }, { -0.907886116f, -0.419216888f },
+    { -0.909167983f, -0.41642956f }, { -0.910441292f, -0.413638312f }, { -0.911706032f, -0.410843171f }, { -0.91296219f, -0.408044163f },
+    { -0.914209756f, -0.405241314f }, { -0.915448716f, -0.402434651f }, { -0.91667906f, -0.3996242f }, { -0.917900776f, -0.396809987f },
+    { -0.919113852f, -0.39399204f }, { -0.920318277f, -0.391170384f }, { -0.921514039f, -0.388345047f }, { -0.922701128f, -0.385516054f },
+    { -0.923879533f, -0.382683432f }, { -0.925049241f, -0.379847209f }, { -0.926210242f, -0.37700741f }, { -0.927362526f, -0.374164063f },
+    { -0.92850608f, -0.371317194f }, { -0.929640896f, -0.36846683f }, { -0.930766961f, -0.365612998f }, { -0.931884266f, -0.362755724f },
+    { -0.932992799f, -0.359895037f }, { -0.93409255f, -0.357030961f }, { -0.93518351f, -0.354163525f }, { -0.936265667f, -0.351292756f },
+    { -0.937339012f, -0.34841868f }, { -0.938403534f, -0.345541325f }, { -0.939459224f, -0.342660717f }, { -0.940506071f, -0.339776884f },
+    { -0.941544065f, -0.336889853f }, { -0.942573198f, -0.333999651f }, { -0.943593458f, -0.331106306f }, { -0.944604837f, -0.328209844f },
+    { -0.945607325f, -0.325310292f }, { -0.946600913f, -0.322407679f }, { -0.947585591f, -0.319502031f }, { -0.94856135f, -0.316593376f },
+    { -0.949528181f, -0.31368174f }, { -0.950486074f, -0.310767153f }, { -0.951435021f, -0.30784964f }, { -0.952375013f, -0.30492923f },
+    { -0.95330604f, -0.302005949f }, { -0.954228095f, -0.299079826f }, { -0.955141168f, -0.296150888f }, { -0.956045251f, -0.293219163f },
+    { -0.956940336f, -0.290284677f }, { -0.957826413f, -0.28734746f }, { -0.958703475f, -0.284407537f }, { -0.959571513f, -0.281464938f },
+    { -0.960430519f, -0.278519689f }, { -0.961280486f, -0.275571819f }, { -0.962121404f, -0.272621355f }, { -0.962953267f, -0.269668326f },
+    { -0.963776066f, -0.266712757f }, { -0.964589793f, -0.263754679f }, { -0.965394442f, -0.260794118f }, { -0.966190003f, -0.257831102f },
+    { -0.966976471f, -0.25486566f }, { -0.967753837f, -0.251897818f }, { -0.968522094f, -0.248927606f }, { -0.969281235f, -0.24595505f },
+    { -0.970031253f, -0.24298018f }, { -0.970772141f, -0.240003022f }, { -0.971503891f, -0.237023606f }, { -0.972226497f, -0.234041959f },
+    { -0.972939952f, -0.231058108f }, { -0.97364425f, -0.228072083f }, { -0.974339383f, -0.225083911f }, { -0.975025345f, -0.222093621f },
+    { -0.97570213f, -0.21910124f }, { -0.976369731f, -0.216106797f }, { -0.977028143f, -0.21311032f }, { -0.977677358f, -0.210111837f },
+    { -0.978317371f, -0.207111376f }, { -0.978948175f, -0.204108966f }, { -0.979569766f, -0.201104635f }, { -0.980182136f, -0.198098411f },
+    { -0.98078528f, -0.195090322f }, { -0.981379193f, -0.192080397f }, { -0.981963869f, -0.189068664f }, { -0.982539302f, -0.186055152f },
+    { -0.983105487f, -0.183039888f }, { -0.983662419f, -0.180022901f }, { -0.984210092f, -0.17700422f }, { -0.984748502f, -0.173983873f },
+    { -0.985277642f, -0.170961889f }, { -0.985797509f, -0.167938295f }, { -0.986308097f, -0.16491312f }, { -0.986809402f, -0.161886394f },
+    { -0.987301418f, -0.158858143f }, { -0.987784142f, -0.155828398f }, { -0.988257568f, -0.152797185f }, { -0.988721692f, -0.149764535f },
+    { -0.98917651f, -0.146730474f }, { -0.989622017f, -0.143695033f }, { -0.99005821f, -0.140658239f }, { -0.990485084f, -0.137620122f },
+    { -0.990902635f, -0.134580709f }, { -0.99131086f, -0.131540029f }, { -0.991709754f, -0.128498111f }, { -0.992099313f, -0.125454983f },
+    { -0.992479535f, -0.122410675f }, { -0.992850414f, -0.119365215f }, { -0.993211949f, -0.116318631f }, { -0.993564136f, -0.113270952f },
+    { -0.99390697f, -0.110222207f }, { -0.994240449f, -0.107172425f }, { -0.994564571f, -0.104121634f }, { -0.994879331f, -0.101069863f },
+    { -0.995184727f, -0.0980171403f }, { -0.995480755f, -0.0949634953f }, { -0.995767414f, -0.0919089565f }, { -0.996044701f, -0.0888535526f },
+    { -0.996312612f, -0.0857973123f }, { -0.996571146f, -0.0827402645f }, { -0.996820299f, -0.079682438f }, { -0.99706007f, -0.0766238614f },
+    { -0.997290457f, -0.0735645636f }, { -0.997511456f, -0.0705045734f }, { -0.997723067f, -0.0674439196f }, { -0.997925286f, -0.0643826309f },
+    { -0.998118113f, -0.0613207363f }, { -0.998301545f, -0.0582582645f }, { -0.998475581f, -0.0551952443f }, { -0.998640218f, -0.0521317047f },
+    { -0.998795456f, -0.0490676743f }, { -0.998941293f, -0.0460031821f }, { -0.999077728f, -0.0429382569f }, { -0.999204759f, -0.0398729276f },
+    { -0.999322385f, -0.0368072229f }, { -0.999430605f, -0.0337411719f }, { -0.999529418f, -0.0306748032f }, { -0.999618822f, -0.0276081458f },
+    { -0.999698819f, -0.0245412285f }, { -0.999769405f, -0.0214740803f }, { -0.999830582f, -0.0184067299f }, { -0.999882347f, -0.0153392063f },
+    { -0.999924702f, -0.0122715383f }, { -0.999957645f, -0.00920375478f }, { -0.999981175f, -0.00613588465f }, { -0.999995294f, -0.00306795676f },
+};
+
+const uint32_t FFT_TwiddleTableQ15[FFT_TABLE_SIZE / 2] =
+{
+    0x00007FFFU, 0xFF9B7FFFU, 0xFF377FFFU, 0xFED27FFFU, 0xFE6E7FFEU, 0xFE097FFCU, 0xFDA57FFAU, 0xFD407FF8U,
+    0xFCDC7FF6U, 0xFC777FF4U, 0xFC137FF1U, 0xFBAE7FEDU, 0xFB4A7FEAU, 0xFAE57FE6U, 0xFA817FE2U, 0xFA1D7FDDU,
+    0xF9B87FD9U, 0xF9547FD3U, 0xF8EF7FCEU, 0xF88B7FC8U, 0xF8277FC2U, 0xF7C27FBCU, 0xF75E7FB5U, 0xF6FA7FAEU,
+    0xF6957FA7U, 0xF6317FA0U, 0xF5CD7F98U, 0xF5697F90U, 0xF5057F87U, 0xF4A07F7EU, 0xF43C7F75U, 0xF3D87F6CU,
+    0xF3747F62U, 0xF3107F58U, 0xF2AC7F4EU, 0xF2487F43U, 0xF1E47F38U, 0xF1807F2DU, 0xF11C7F22U, 0xF0B97F16U,
+    0xF0557F0AU, 0xEFF17EFDU, 0xEF8D7EF0U, 0xEF2A7EE3U, 0xEEC67ED6U, 0xEE627EC8U, 0xEDFF7EBAU, 0xED9B7EACU,
+    0xED387E9DU, 0xECD57E8EU, 0xEC717E7FU, 0xEC0E7E70U, 0xEBAB7E60U, 0xEB477E50U, 0xEAE47E3FU, 0xEA817E2FU,
+    0xEA1E7E1EU, 0xE9BB7E0CU, 0xE9587DFBU, 0xE8F57DE9U, 0xE8927DD6U, 0xE82F7DC4U, 0xE7CD7DB1U, 0xE76A7D9EU,
+    0xE7077D8AU, 0xE6A57D77U, 0xE6427D63U, 0xE5E07D4EU, 0xE57D7D3AU, 0xE51B7D25U, 0xE4B97D0FU, 0xE4577CFAU,
+    0xE3F47CE4U, 0xE3927CCEU, 0xE3307CB7U, 0xE2CF7CA0U, 0xE26D7C89U, 0xE20B7C72U, 0xE1A97C5AU, 0xE1487C42U,
+    0xE0E67C2AU, 0xE0857C11U, 0xE0237BF9U, 0xDFC27BDFU, 0xDF617BC6U, 0xDEFF7BACU, 0xDE9E7B92U, 0xDE3D7B78U,
+    0xDDDC7B5DU, 0xDD7C7B42U, 0xDD1B7B27U, 0xDCBA7B0BU, 0xDC597AEFU, 0xDBF97AD3U, 0xDB997AB7U, 0xDB387A9AU,
+    0xDAD87A7DU, 0xDA787A60U, 0xDA187A42U, 0xD9B87A24U, 0xD9587A06U, 0xD8F879E7U, 0xD89879C9U, 0xD83979AAU,
+    0xD7D9798AU, 0xD77A796AU, 0xD71B794AU, 0xD6BB792AU, 0xD65C790AU, 0xD5FD78E9U, 0xD59E78C8U, 0xD53F78A6U,
+    0xD4E17885U, 0xD4827863U, 0xD4247840U, 0xD3C5781EU, 0xD36777FBU, 0xD30977D8U, 0xD2AB77B4U, 0xD24D7790U,
+    0xD1EF776CU, 0xD1917748U, 0xD1347723U, 0xD0D676FEU, 0xD07976D9U, 0xD01B76B4U, 0xCFBE768EU, 0xCF617668U,
+    0xCF047642U, 0xCEA7761BU, 0xCE4B75F4U, 0xCDEE75CDU, 0xCD9275A6U, 0xCD35757EU, 0xCCD97556U, 0xCC7D752DU,
+    0xCC217505U, 0xCBC574DCU, 0xCB6974B3U, 0xCB0E7489U, 0xCAB27460U, 0xCA577436U, 0xC9FC740BU, 0xC9A173E1U,
+    0xC94673B6U, 0xC8EB738BU, 0xC890735FU, 0xC8367334U, 0xC7DB7308U, 0xC78172DCU, 0xC72772AFU, 0xC6CD7282U,
+    0xC6737255U, 0xC6197228U, 0xC5C071FAU, 0xC56671CCU, 0xC50D719EU, 0xC4B47170U, 0xC45B7141U, 0xC4027112U,
+    0xC3A970E3U, 0xC35170B3U, 0xC2F87083U, 0xC2A07053U, 0xC2487023U, 0xC1F06FF2U, 0xC1986FC2U, 0xC1406F90U,
+    0xC0E96F5FU, 0xC0916F2DU, 0xC03A6EFBU, 0xBFE36EC9U, 0xBF8C6E97U, 0xBF356E64U, 0xBEDF6E31U, 0xBE886DFEU,
+    0xBE326DCAU, 0xBDDC6D96U, 0xBD866D62U, 0xBD306D2EU, 0xBCDA6CF9U, 0xBC856CC4U, 0xBC2F6C8FU, 0xBBDA6C5AU,
+    0xBB856C24U, 0xBB306BEEU, 0xBADC6BB8U, 0xBA876B82U, 0xBA336B4BU, 0xB9DF6B14U, 0xB98B6ADDU, 0xB9376AA5U,
+    0xB8E36A6EU, 0xB8906A36U, 0xB83C69FDU, 0xB7E969C5U, 0xB796698CU, 0xB7436953U, 0xB6F1691AU, 0xB69E68E0U,
+    0xB64C68A7U, 0xB5FA686DU, 0xB5A86832U, 0xB55667F8U, 0xB50567BDU, 0xB4B36782U, 0xB4626747U, 0xB411670BU,
+    0xB3C066D0U, 0xB36F6693U, 0xB31F6657U, 0xB2CF661BU, 0xB27F65DEU, 0xB22F65A1U, 0xB1DF6564U, 0xB18F6526U,
+    0xB14064E9U, 0xB0F164ABU, 0xB0A2646CU, 0xB053642EU, 0xB00563EFU, 0xAFB663B0U, 0xAF686371U, 0xAF1A6332U,
+    0xAECC62F2U, 0xAE7F62B2U, 0xAE316272U, 0xADE46232U, 0xAD9761F1U, 0xAD4A61B0U, 0xACFD616FU, 0xACB1612EU,
+    0xAC6560ECU, 0xAC1960AAU, 0xABCD6068U, 0xAB816026U, 0xAB365FE4U, 0xAAEB5FA1U, 0xAAA05F5EU, 0xAA555F1BU,
+    0xAA0A5ED7U, 0xA9C05E94U, 0xA9765E50U, 0xA92C5E0CU, 0xA8E25DC8U, 0xA8995D83U, 0xA84F5D3EU, 0xA8065CF9U,
+    0xA7BD5CB4U, 0xA7745C6FU, 0xA72C5C29U, 0xA6E45BE3U, 0xA69C5B9DU, 0xA6545B57U, 0xA60C5B10U, 0xA5C55AC9U,
+    0xA57E5A82U, 0xA5375A3BU, 0xA4F059F4U, 0xA4A959ACU, 0xA4635964U, 0xA41D591CU, 0xA3D758D4U, 0xA391588CU,
+    0xA34C5843U, 0xA30757FAU, 0xA2C257B1U, 0xA27D5767U, 0xA238571EU, 0xA1F456D4U, 0xA1B0568AU, 0xA16C5640U,
+    0xA12955F6U, 0xA0E555ABU, 0xA0A25560U, 0xA05F5515U, 0xA01C54CAU, 0x9FDA547FU, 0x9F985433U, 0x9F5653E7U,
+    0x9F14539BU, 0x9ED2534FU, 0x9E915303U, 0x9E5052B6U, 0x9E0F5269U, 0x9DCE521CU, 0x9D8E51CFU, 0x9D4E5181U,
+    0x9D0E5134U, 0x9CCE50E6U, 0x9C8F5098U, 0x9C50504AU, 0x9C114FFBU, 0x9BD24FADU, 0x9B944F5EU, 0x9B554F0FU,
+    0x9B174EC0U, 0x9ADA4E71U, 0x9A9C4E21U, 0x9A5F4DD1U, 0x9A224D81U, 0x99E54D31U, 0x99A94CE1U, 0x996D4C91U,
+    0x99304C40U, 0x98F54BEFU, 0x98B94B9EU, 0x987E4B4DU, 0x98434AFBU, 0x98084AAAU, 0x97CE4A58U, 0x97934A06U,
+    0x975949B4U, 0x97204962U, 0x96E6490FU, 0x96AD48BDU, 0x9674486AU, 0x963B4817U, 0x960347C4U, 0x95CA4770U,
+    0x9592471DU, 0x955B46C9U, 0x95234675U, 0x94EC4621U, 0x94B545CDU, 0x947E4579U, 0x94484524U, 0x941244D0U,
+    0x93DC447BU, 0x93A64426U, 0x937143D1U, 0x933C437BU, 0x93074326U, 0x92D242D0U, 0x929E427AU, 0x926A4224U,
+    0x923641CEU, 0x92024178U, 0x91CF4121U, 0x919C40CBU, 0x91694074U, 0x9137401DU, 0x91053FC6U, 0x90D33F6FU,
+    0x90A13F17U, 0x90703EC0U, 0x903E3E68U, 0x900E3E10U, 0x8FDD3DB8U, 0x8FAD3D60U, 0x8F7D3D08U, 0x8F4D3CAFU,
+    0x8F1D3C57U, 0x8EEE3BFEU, 0x8EBF3BA5U, 0x8E903B4CU, 0x8E623AF3U, 0x8E343A9AU, 0x8E063A40U, 0x8DD839E7U,
+    0x8DAB398DU, 0x8D7E3933U, 0x8D5138D9U, 0x8D24387FU, 0x8CF83825U, 0x8CCC37CAU, 0x8CA13770U, 0x8C753715U,
+    0x8C4A36BAU, 0x8C1F365FU, 0x8BF53604U, 0x8BCA35A9U, 0x8BA0354EU, 0x8B7734F2U, 0x8B4D3497U, 0x8B24343BU,
+    0x8AFB33DFU, 0x8AD33383U, 0x8AAA3327U, 0x8A8232CBU, 0x8A5A326EU, 0x8A333212U, 0x8A0C31B5U, 0x89E53159U,
+    0x89BE30FCU, 0x8998309FU, 0x89723042U, 0x894C2FE5U, 0x89272F87U, 0x89022F2AU, 0x88DD2ECCU, 0x88B82E6FU,
+    0x88942E11U, 0x88702DB3U, 0x884C2D55U, 0x88282CF7U, 0x88052C99U, 0x87E22C3BU, 0x87C02BDCU, 0x879D2B7EU,
+    0x877B2B1FU, 0x875A2AC1U, 0x87382A62U, 0x87172A03U, 0x86F629A4U, 0x86D62945U, 0x86B628E5U, 0x86962886U,
+    0x86762827U, 0x865627C7U, 0x86372768U, 0x86192708U, 0x85FA26A8U, 0x85DC2648U, 0x85BE25E8U, 0x85A02588U,
+    0x85832528U, 0x856624C8U, 0x85492467U, 0x852D2407U, 0x851123A7U, 0x84F52346U, 0x84D922E5U, 0x84BE2284U,
+    0x84A32224U, 0x848821C3U, 0x846E2162U, 0x84542101U, 0x843A209FU, 0x8421203EU, 0x84071FDDU, 0x83EF1F7BU,
+    0x83D61F1AU, 0x83BE1EB8U, 0x83A61E57U, 0x838E1DF5U, 0x83771D93U, 0x83601D31U, 0x83491CD0U, 0x83321C6EU,
+    0x831C1C0CU, 0x83061BA9U, 0x82F11B47U, 0x82DB1AE5U, 0x82C61A83U, 0x82B21A20U, 0x829D19BEU, 0x8289195BU,
+    0x827618F9U, 0x82621896U, 0x824F1833U, 0x823C17D1U, 0x822A176EU, 0x8217170BU, 0x820516A8U, 0x81F41645U,
+    0x81E215E2U, 0x81D1157FU, 0x81C1151CU, 0x81B014B9U, 0x81A01455U, 0x819013F2U, 0x8181138FU, 0x8172132BU,
+    0x816312C8U, 0x81541265U, 0x81461201U, 0x8138119EU, 0x812A113AU, 0x811D10D6U, 0x81101073U, 0x8103100FU,
+    0x80F60FABU, 0x80EA0F47U, 0x80DE0EE4U, 0x80D30E80U, 0x80C80E1CU, 0x80BD0DB8U, 0x80B20D54U, 0x80A80CF0U,
+    0x809E0C8CU, 0x80940C28U, 0x808B0BC4U, 0x80820B60U, 0x80790AFBU, 0x80700A97U, 0x80680A33U, 0x806009CFU,
+    0x8059096BU, 0x80520906U, 0x804B08A2U, 0x8044083EU, 0x803E07D9U, 0x80380775U, 0x80320711U, 0x802D06ACU,
+    0x80270648U, 0x802305E3U, 0x801E057FU, 0x801A051BU, 0x801604B6U, 0x80130452U, 0x800F03EDU, 0x800C0389U,
+    0x800A0324U, 0x800802C0U, 0x8006025BU, 0x800401F7U, 0x80020192U, 0x8001012EU, 0x800100C9U, 0x80000065U,
+    0x80000000U, 0x8000FF9BU, 0x8001FF37U, 0x8001FED2U, 0x8002FE6EU, 0x8004FE09U, 0x8006FDA5U, 0x8008FD40U,
+    0x800AFCDCU, 0x800CFC77U, 0x800FFC13U, 0x8013FBAEU, 0x8016FB4AU, 0x801AFAE5U, 0x801EFA81U, 0x8023FA1DU,
+    0x8027F9B8U, 0x802DF954U, 0x8032F8EFU, 0x8038F88BU, 0x803EF827U, 0x8044F7C2U, 0x804BF75EU, 0x8052F6FAU,
+    0x8059F695U, 0x8060F631U, 0x8068F5CDU, 0x8070F569U, 0x8079F505U, 0x8082F4A0U, 0x808BF43CU, 0x8094F3D8U,
+    0x809EF374U, 0x80A8F310U, 0x80B2F2ACU, 0x80BDF248U, 0x80C8F1E4U, 0x80D3F180U, 0x80DEF11CU, 0x80EAF0B9U,
+    0x80F6F055U, 0x8103EFF1U, 0x8110EF8DU, 0x811DEF2AU, 0x812AEEC6U, 0x8138EE62U, 0x8146EDFFU, 0x8154ED9BU,
+    0x8163ED38U, 0x8172ECD5U, 0x8181EC71U, 0x8190EC0EU, 0x81A0EBABU, 0x81B0EB47U, 0x81C1EAE4U, 0x81D1EA81U,
+    0x81E2EA1EU, 0x81F4E9BBU, 0x8205E958U, 0x8217E8F5U, 0x822AE892U, 0x823CE82FU, 0x824FE7CDU, 0x8262E76AU,
+    0x8276E707U, 0x8289E6A5U, 0x829DE642U, 0x82B2E5E0U, 0x82C6E57DU, 0x82DBE51BU, 0x82F1E4B9U, 0x8306E457U,
+    0x831CE3F4U, 0x8332E392U, 0x8349E330U, 0x8360E2CFU, 0x8377E26DU, 0x838EE20BU, 0x83A6E1A9U, 0x83BEE148U,
+    0x83D6E0E6U, 0x83EFE085U, 0x8407E023U, 0x8421DFC2U, 0x843ADF61U, 0x8454DEFFU, 0x846EDE9EU, 0x8488DE3DU,
+    0x84A3DDDCU, 0x84BEDD7CU, 0x84D9DD1BU, 0x84F5DCBAU, 0x8511DC59U, 0x852DDBF9U, 0x8549DB99U, 0x8566DB38U,
+    0x8583DAD8U, 0x85A0DA78U, 0x85BEDA18U, 0x85DCD9B8U, 0x85FAD958U, 0x8619D8F8U, 0x8637D898U, 0x8656D839U,
+    0x8676D7D9U, 0x8696D77AU, 0x86B6D71BU, 0x86D6D6BBU, 0x86F6D65CU, 0x8717D5FDU, 0x8738D59EU, 0x875AD53FU,
+    0x877BD4E1U, 0x879DD482U, 0x87C0D424U, 0x87E2D3C5U, 0x8805D367U, 0x8828D309U, 0x884CD2ABU, 0x8870D24DU,
+    0x8894D1EFU, 0x88B8D191U, 0x88DDD134U, 0x8902D0D6U, 0x8927D079U, 0x894CD01BU, 0x8972CFBEU, 0x8998CF61U,
+    0x89BECF04U, 0x89E5CEA7U, 0x8A0CCE4BU, 0x8A33CDEEU, 0x8A5ACD92U, 0x8A82CD35U, 0x8AAACCD9U, 0x8AD3CC7DU,
+    0x8AFBCC21U, 0x8B24CBC5U, 0x8B4DCB69U, 0x8B77CB0EU, 0x8BA0CAB2U, 0x8BCACA57U, 0x8BF5C9FCU, 0x8C1FC9A1U,
+    0x8C4AC946U, 0x8C75C8EBU, 0x8CA1C890U, 0x8CCCC836U, 0x8CF8C7DBU, 0x8D24C781U, 0x8D51C727U, 0x8D7EC6CDU,
+    0x8DABC673U, 0x8DD8C619U, 0x8E06C5C0U, 0x8E34C566U, 0x8E62C50DU, 0x8E90C4B4U, 0x8EBFC45BU, 0x8EEEC402U,
+    0x8F1DC3A9U, 0x8F4DC351U, 0x8F7DC2F8U, 0x8FADC2A0U, 0x8FDDC248U, 0x900EC1F0U, 0x903EC198U, 0x9070C140U,
+    0x90A1C0E9U, 0x90D3C091U, 0x9105C03AU, 0x9137BFE3U, 0x9169BF8CU, 0x919CBF35U, 0x91CFBEDFU, 0x9202BE88U,
+    0x9236BE32U, 0x926ABDDCU, 0x929EBD86U, 0x92D2BD30U, 0x9307BCDAU, 0x933CBC85U, 0x9371BC2FU, 0x93A6BBDAU,
+    0x93DCBB85U, 0x9412BB30U, 0x9448BADCU, 0x947EBA87U, 0x94B5BA33U, 0x94ECB9DFU, 0x9523B98BU, 0x955BB937U,
+    0x9592B8E3U, 0x95CAB890U, 0x9603B83CU, 0x963BB7E9U, 0x9674B796U, 0x96ADB743U, 0x96E6B6F1U, 0x9720B69EU,
+    0x9759B64CU, 0x9793B5FAU, 0x97CEB5A8U, 0x9808B556U, 0x9843B505U, 0x987EB4B3U, 0x98B9B462U, 0x98F5B411U,
+    0x9930B3C0U, 0x996DB36FU, 0x99A9B31FU, 0x99E5B2CFU, 0x9A22B27FU, 0x9A5FB22FU, 0x9A9CB1DFU, 0x9ADAB18FU,
+    0x9B17B140U, 0x9B55B0F1U, 0x9B94B0A2U, 0x9BD2B053U, 0x9C11B005U, 0x9C50AFB6U, 0x9C8FAF68U, 0x9CCEAF1AU,
+    0x9D0EAECCU, 0x9D4EAE7FU, 0x9D8EAE31U, 0x9DCEADE4U, 0x9E0FAD97U, 0x9E50AD4AU, 0x9E91ACFDU, 0x9ED2ACB1U,
+    0x9F14AC65U, 0x9F56AC19U, 0x9F98ABCDU, 0x9FDAAB81U, 0xA01CAB36U, 0xA05FAAEBU, 0xA0A2AAA0U, 0xA0E5AA55U,
+    0xA129AA0AU, 0xA16CA9C0U, 0xA1B0A976U, 0xA1F4A92CU, 0xA238A8E2U, 0xA27DA899U, 0xA2C2A84FU, 0xA307A806U,
+    0xA34CA7BDU, 0xA391A774U, 0xA3D7A72CU, 0xA41DA6E4U, 0xA463A69CU, 0xA4A9A654U, 0xA4F0A60CU, 0xA537A5C5U,
+    0xA57EA57EU, 0xA5C5A537U, 0xA60CA4F0U, 0xA654A4A9U, 0xA69CA463U, 0xA6E4A41DU, 0xA72CA3D7U, 0xA774A391U,
+    0xA7BDA34CU, 0xA806A307U, 0xA84FA2C2U, 0xA899A27DU, 0xA8E2A238U, 0xA92CA1F4U, 0xA976A1B0U, 0xA9C0A16CU,
+    0xAA0AA129U, 0xAA55A0E5U, 0xAAA0A0A2U, 0xAAEBA05FU, 0xAB36A01CU, 0xAB819FDAU, 0xABCD9F98U, 0xAC199F56U,
+    0xAC659F14U, 0xACB19ED2U, 0xACFD9E91U, 0xAD4A9E50U, 0xAD979E0FU, 0xADE49DCEU, 0xAE319D8EU, 0xAE7F9D4EU,
+    0xAECC9D0EU, 0xAF1A9CCEU, 0xAF689C8FU, 0xAFB69C50U, 0xB0059C11U, 0xB0539BD2U, 0xB0A29B94U, 0xB0F19B55U,
+    0xB1409B17U, 0xB18F9ADAU, 0xB1DF9A9CU, 0xB22F9A5FU, 0xB27F9A22U, 0xB2CF99E5U, 0xB31F99A9U, 0xB36F996DU,
+    0xB3C09930U, 0xB41198F5U, 0xB46298B9U, 0xB4B3987EU, 0xB5059843U, 0xB5569808U, 0xB5A897CEU, 0xB5FA9793U,
+    0xB64C9759U, 0xB69E9720U, 0xB6F196E6U, 0xB74396ADU, 0xB7969674U, 0xB7E9963BU, 0xB83C9603U, 0xB89095CAU,
+    0xB8E39592U, 0xB937955BU, 0xB98B9523U, 0xB9DF94ECU, 0xBA3394B5U, 0xBA87947EU, 0xBADC9448U, 0xBB309412U,
+    0xBB8593DCU, 0xBBDA93A6U, 0xBC2F9371U, 0xBC85933CU, 0xBCDA9307U, 0xBD3092D2U, 0xBD86929EU, 0xBDDC926AU,
+    0xBE329236U, 0xBE889202U, 0xBEDF91CFU, 0xBF35919CU, 0xBF8C9169U, 0xBFE39137U, 0xC03A9105U, 0xC09190D3U,
+    0xC0E990A1U, 0xC1409070U, 0xC198903EU, 0xC1F0900EU, 0xC2488FDDU, 0xC2A08FADU, 0xC2F88F7DU, 0xC3518F4DU,
+    0xC3A98F1DU, 0xC4028EEEU, 0xC45B8EBFU, 0xC4B48E90U, 0xC50D8E62U, 0xC5668E34U, 0xC5C08E06U, 0xC6198DD8U,
+    0xC6738DABU, 0xC6CD8D7EU, 0xC7278D51U, 0xC7818D24U, 0xC7DB8CF8U, 0xC8368CCCU, 0xC8908CA1U, 0xC8EB8C75U,
+    0xC9468C4AU, 0xC9A18C1FU, 0xC9FC8BF5U, 0xCA578BCAU, 0xCAB28BA0U, 0xCB0E8B77U, 0xCB698B4DU, 0xCBC58B24U,
+    0xCC218AFBU, 0xCC7D8AD3U, 0xCCD98AAAU, 0xCD358A82U, 0xCD928A5AU, 0xCDEE8A33U, 0xCE4B8A0CU, 0xCEA789E5U,
+    0xCF0489BEU, 0xCF618998U, 0xCFBE8972U, 0xD01B894CU, 0xD0798927U, 0xD0D68902U, 0xD13488DDU, 0xD19188B8U,
+    0xD1EF8894U, 0xD24D8870U, 0xD2AB884CU, 0xD3098828U, 0xD3678805U, 0xD3C587E2U, 0xD42487C0U, 0xD482879DU,
+    0xD4E1877BU, 0xD53F875AU, 0xD59E8738U, 0xD5FD8717U, 0xD65C86F6U, 0xD6BB86D6U, 0xD71B86B6U, 0xD77A8696U,
+    0xD7D98676U, 0xD8398656U, 0xD8988637U, 0xD8F88619U, 0xD95885FAU, 0xD9B885DCU, 0xDA1885BEU, 0xDA7885A0U,
+    0xDAD88583U, 0xDB388566U, 0xDB998549U, 0xDBF9852DU, 0xDC598511U, 0xDCBA84F5U, 0xDD1B84D9U, 0xDD7C84BEU,
+    0xDDDC84A3U, 0xDE3D8488U, 0xDE9E846EU, 0xDEFF8454U, 0xDF61843AU, 0xDFC28421U, 0xE0238407U, 0xE08583EFU,
+    0xE0E683D6U, 0xE14883BEU, 0xE1A983A6U, 0xE20B838EU, 0xE26D8377U, 0xE2CF8360U, 0xE3308349U, 0xE3928332U,
+    0xE3F4831CU, 0xE4578306U, 0xE4B982F1U, 0xE51B82DBU, 0xE57D82C6U, 0xE5E082B2U, 0xE642829DU, 0xE6A58289U,
+    0xE7078276U, 0xE76A8262U, 0xE7CD824FU, 0xE82F823CU, 0xE892822AU, 0xE8F58217U, 0xE9588205U, 0xE9BB81F4U,
+    0xEA1E81E2U, 0xEA8181D1U, 0xEAE481C1U, 0xEB4781B0U, 0xEBAB81A0U, 0xEC0E8190U, 0xEC718181U, 0xECD58172U,
+    0xED388163U, 0xED9B8154U, 0xEDFF8146U, 0xEE628138U, 0xEEC6812AU, 0xEF2A811DU, 0xEF8D8110U, 0xEFF18103U,
+    0xF05580F6U, 0xF0B980EAU, 0xF11C80DEU, 0xF18080D3U, 0xF1E480C8U, 0xF24880BDU, 0xF2AC80B2U, 0xF31080A8U,
+    0xF374809EU, 0xF3D88094U, 0xF43C808BU, 0xF4A08082U, 0xF5058079U, 0xF5698070U, 0xF5CD8068U, 0xF6318060U,
+    0xF6958059U, 0xF6FA8052U, 0xF75E804BU, 0xF7C28044U, 0xF827803EU, 0xF88B8038U, 0xF8EF8032U, 0xF954802DU,
+    0xF9B88027U, 0xFA1D8023U, 0xFA81801EU, 0xFAE5801AU, 0xFB4A8016U, 0xFBAE8013U, 0xFC13800FU, 0xFC77800CU,
+    0xFCDC800AU, 0xFD408008U, 0xFDA58006U, 0xFE098004U, 0xFE6E8002U, 0xFED28001U, 0xFF378001U, 0xFF9B8000U,
+};
+
+const uint16_t FFT_BitReverseTable[FFT_BIT_REVERSE_SWAPS][2] =
+{
+    { 1, 1024 }, { 2, 512 }, { 3, 1536 }, { 4, 256 }, { 5, 1280 }, { 6, 768 }, { 7, 1792 }, { 8, 128 },
+    { 9, 1152 }, { 10, 640 }, { 11, 1664 }, { 12, 384 }, { 13, 1408 }, { 14, 896 }, { 15, 1920 }, { 16, 64 },
+    { 17, 1088 }, { 18, 576 }, { 19, 1600 }, { 20, 320 }, { 21, 1344 }, { 22, 832 }, { 23, 1856 }, { 24, 192 },
+    { 25, 1216 }, { 26, 704 }, { 27, 1728 }, { 28, 448 }, { 29, 1472 }, { 30, 960 }, { 31, 1984 }, { 33, 1056 },
+    { 34, 544 }, { 35, 1568 }, { 36, 288 }, { 37, 1312 }, { 38, 800 }, { 39, 1824 }, { 40, 160 }, { 41, 1184 },
+    { 42, 672 }, { 43, 1696 }, { 44, 416 }, { 45, 1440 }, { 46, 928 }, { 47, 1952 }, { 48, 96 }, { 49, 1120 },
+    { 50, 608 }, { 51, 1632 }, { 52, 352 }, { 53, 1376 }, { 54, 864 }, { 55, 1888 }, { 56, 224 }, { 57, 1248 },
+    { 58, 736 }, { 59, 1760 }, { 60, 480 }, { 61, 1504 }, { 62, 992 }, { 63, 2016 }, { 65, 1040 }, { 66, 528 },
+    { 67, 1552 }, { 68, 272 }, { 69, 1296 }, { 70, 784 }, { 71, 1808 }, { 72, 144 }, { 73, 1168 }, { 74, 656 },
+    { 75, 1680 }, { 76, 400 }, { 77, 1424 }, { 78, 912 }, { 79, 1936 }, { 81, 1104 }, { 82, 592 }, { 83, 1616 },
+    { 84, 336 }, { 85, 1360 }, { 86, 848 }, { 87, 1872 }, { 88, 208 }, { 89, 1232 }, { 90, 720 }, { 91, 1744 },
+    { 92, 464 }, { 93, 1488 }, { 94, 976 }, { 95, 2000 }, { 97, 1072 }, { 98, 560 }, { 99, 1584 }, { 100, 304 },
+    { 101, 1328 }, { 102, 816 }, { 103, 1840 }, { 104, 176 }, { 105, 1200 }, { 106, 688 }, { 107, 1712 }, { 108, 432 },
+    { 109, 1456 }, { 110, 944 }, { 111, 1968 }, { 113, 1136 }, { 114, 624 }, { 115, 1648 }, { 116, 368 }, { 117, 1392 },
+    { 118, 880 }, { 119, 1904 }, { 120, 240 }, { 121, 1264 }, { 122, 752 }, { 123, 1776 }, { 124, 496 }, { 125, 1520 },
+    { 126, 1008 }, { 127, 2032 }, { 129, 1032 }, { 130, 520 }, { 131, 1544 }, { 132, 264 }, { 133, 1288 }, { 134, 776 },
+    { 135, 1800 }, { 137, 1160 }, { 138, 648 }, { 139, 1672 }, { 140, 392 }, { 141, 1416 }, { 142, 904 }, { 143, 1928 },
+    { 145, 1096 }, { 146, 584 }, { 147, 1608 }, { 148, 328 }, { 149, 1352 }, { 150, 840 }, { 151, 1864 }, { 152, 200 },
+    { 153, 1224 }, { 154, 712 }, { 155, 1736 }, { 156, 456 }, { 157, 1480 }, { 158, 968 }, { 159, 1992 }, { 161, 1064 },
+    { 162, 552 }, { 163, 1576 }, { 164, 296 }, { 165, 1320 }, { 166, 808 }, { 167, 1832 }, { 169, 1192 }, { 170, 680 },
+    { 171, 1704 }, { 172, 424 }, { 173, 1448 }, { 174, 936 }, { 175, 1960 }, { 177, 1128 }, { 178, 616 }, { 179, 1640 },
+    { 180, 360 }, { 181, 1384 }, { 182, 872 }, { 183, 1896 }, { 184, 232 }, { 185, 1256 }, { 186, 744 }, { 187, 1768 },
+    { 188, 488 }, { 189, 1512 }, { 190, 1000 }, { 191, 2024 }, { 193, 1048 }, { 194, 536 }, { 195, 1560 }, { 196, 280 },
+    { 197, 1304 }, { 198, 792 }, { 199, 1816 }, { 201, 1176 }, { 202, 664 }, { 203, 1688 }, { 204, 408 }, { 205, 1432 },
+    { 206, 920 }, { 207, 1944 }, { 209, 1112 }, { 210, 600 }, { 211, 1624 }, { 212, 344 }, { 213, 1368 }, { 214, 856 },
+    { 215, 1880 }, { 217, 1240 }, { 218, 728 }, { 219, 1752 }, { 220, 472 }, { 221, 1496 }, { 222, 984 }, { 223, 2008 },
+    { 225, 1080 }, { 226, 568 }, { 227, 1592 }, { 228, 312 }, { 229, 1336 }, { 230, 824 }, { 231, 1848 }, { 233, 1208 },
+    { 234, 696 }, { 235, 1720 }, { 236, 440 }, { 237, 1464 }, { 238, 952 }, { 239, 1976 }, { 241, 1144 }, { 242, 632 },
+    { 243, 1656 }, { 244, 376 }, { 245, 1400 }, { 246, 888 }, { 247, 1912 }, { 249, 1272 }, { 250, 760 }, { 251, 1784 },
+    { 252, 504 }, { 253, 1528 }, { 254, 1016 }, { 255, 2040 }, { 257, 1028 }, { 258, 516 }, { 259, 1540 }, { 261, 1284 },
+    { 262, 772 }, { 263, 1796 }, { 265, 1156 }, { 266, 644 }, { 267, 1668 }, { 268, 388 }, { 269, 1412 }, { 270, 900 },
+    { 271, 1924 }, { 273, 1092 }, { 274, 580 }, { 275, 1604 }, { 276, 324 }, { 277, 1348 }, { 278, 836 }, { 279, 1860 },
+    { 281, 1220 }, { 282, 708 }, { 283, 1732 }, { 284, 452 }, { 285, 1476 }, { 286, 964 }, { 287, 1988 }, { 289, 1060 },
+    { 290, 548 }, { 291, 1572 }, { 293, 1316 }, { 294, 804 }, { 295, 1828 }, { 297, 1188 }, { 298, 676 }, { 299, 1700 },
+    { 300, 420 }, { 301, 1444 }, { 302, 932 }, { 303, 1956 }, { 305, 1124 }, { 306, 612 }, { 307, 1636 }, { 308, 356 },
+    { 309, 1380 }, { 310, 868 }, { 311, 1892 }, { 313, 1252 }, { 314, 740 }, { 315, 1764 }, { 316, 484 }, { 317, 1508 },
+    { 318, 996 }, { 319, 2020 }, { 321, 1044 }, { 322, 532 }, { 323, 1556 }, { 325, 1300 }, { 326, 788 }, { 327, 1812 },
+    { 329, 1172 }, { 330, 660 }, { 331, 1684 }, { 332, 404 }, { 333, 1428 }, { 334, 916 }, { 335, 1940 }, { 337, 1108 },
+    { 338, 596 }, { 339, 1620 }, { 341, 1364 }, { 342, 852 }, { 343, 1876 }, { 345, 1236 }, { 346, 724 }, { 347, 1748 },
+    { 348, 468 }, { 349, 1492 }, { 350, 980 }, { 351, 2004 }, { 353, 1076 }, { 354, 564 }, { 355, 1588 }, { 357, 1332 },
+    { 358, 820 }, { 359, 1844 }, { 361, 1204 }, { 362, 692 }, { 363, 1716 }, { 364, 436 }, { 365, 1460 }, { 366, 948 },
+    { 367, 1972 }, { 369, 1140 }, { 370, 628 }, { 371, 1652 }, { 373, 1396 }, { 374, 884 }, { 375, 1908 }, { 377, 1268 },
+    { 378, 756 }, { 379, 1780 }, { 380, 500 }, { 381, 1524 }, { 382, 1012 }, { 383, 2036 }, { 385, 1036 }, { 386, 524 },
+    { 387, 1548 }, { 389, 1292 }, { 390, 780 }, { 391, 1804 }, { 393, 1164 }, { 394, 652 }, { 395, 1676 }, { 397, 1420 },
+    { 398, 908 }, { 399, 1932 }, { 401, 1100 }, { 402, 588 }, { 403, 1612 }, { 405, 1356 }, { 406, 844 }, { 407, 1868 },
+    { 409, 1228 }, { 410, 716 }, { 411, 1740 }, { 412, 460 }, { 413, 1484 }, { 414, 972 }, { 415, 1996 }, { 417, 1068 },
+    { 418, 556 }, { 419, 1580 }, { 421, 1324 }, { 422, 812 }, { 423, 1836 }, { 425, 1196 }, { 426, 684 }, { 427, 1708 },
+    { 429, 1452 }, { 430, 940 }, { 431, 1964 }, { 433, 1132 }, { 434, 620 }, { 435, 1644 }, { 437, 1388 }, { 438, 876 },
+    { 439, 1900 }, { 441, 1260 }, { 442, 748 }, { 443, 1772 }, { 444, 492 }, { 445, 1516 }, { 446, 1004 }, { 447, 2028 },
+    { 449, 1052 }, { 450, 540 }, { 451, 1564 }, { 453, 1308 }, { 454, 796 }, { 455, 1820 }, { 457, 1180 }, { 458, 668 },
+    { 459, 1692 }, { 461, 1436 }, { 462, 924 }, { 463, 1948 }, { 465, 1116 }, { 466, 604 }, { 467, 1628 }, { 469, 1372 },
+    { 470, 860 }, { 471, 1884 }, { 473, 1244 }, { 474, 732 }, { 475, 1756 }, { 477, 1500 }, { 478, 988 }, { 479, 2012 },
+    { 481, 1084 }, { 482, 572 }, { 483, 1596 }, { 485, 1340 }, { 486, 828 }, { 487, 1852 }, { 489, 1212 }, { 490, 700 },
+    { 491, 1724 }, { 493, 1468 }, { 494, 956 }, { 495, 1980 }, { 497, 1148 }, { 498, 636 }, { 499, 1660 }, { 501, 1404 },
+    { 502, 892 }, { 503, 1916 }, { 505, 1276 }, { 506, 764 }, { 507, 1788 }, { 509, 1532 }, { 510, 1020 }, { 511, 2044 },
+    { 513, 1026 }, { 515, 1538 }, { 517, 1282 }, { 518, 770 }, { 519, 1794 }, { 521, 1154 }, { 522, 642 }, { 523, 1666 },
+    { 525, 1410 }, { 526, 898 }, { 527, 1922 }, { 529, 1090 }, { 530, 578 }, { 531, 1602 }, { 533, 1346 }, { 534, 834 },
+    { 535, 1858 }, { 537, 1218 }, { 538, 706 }, { 539, 1730 }, { 541, 1474 }, { 542, 962 }, { 543, 1986 }, { 545, 1058 },
+    { 547, 1570 }, { 549, 1314 }, { 550, 802 }, { 551, 1826 }, { 553, 1186 }, { 554, 674 }, { 555, 1698 }, { 557, 1442 },
+    { 558, 930 }, { 559, 1954 }, { 561, 1122 }, { 562, 610 }, { 563, 1634 }, { 565, 1378 }, { 566, 866 }, { 567, 1890 },
+    { 569, 1250 }, { 570, 738 }, { 571, 1762 }, { 573, 1506 }, { 574, 994 }, { 575, 2018 }, { 577, 1042 }, { 579, 1554 },
+    { 581, 1298 }, { 582, 786 }, { 583, 1810 }, { 585, 1170 }, { 586, 658 }, { 587, 1682 }, { 589, 1426 }, { 590, 914 },
+    { 591, 1938 }, { 593, 1106 }, { 595, 1618 }, { 597, 1362 }, { 598, 850 }, { 599, 1874 }, { 601, 1234 }, { 602, 722 },
+    { 603, 1746 }, { 605, 1490 }, { 606, 978 }, { 607, 2002 }, { 609, 1074 }, { 611, 1586 }, { 613, 1330 }, { 614, 818 },
+    { 615, 1842 }, { 617, 1202 }, { 618, 690 }, { 619, 1714 }, { 621, 1458 }, { 622, 946 }, { 623, 1970 }, { 625, 1138 },
+    { 627, 1650 }, { 629, 1394 }, { 630, 882 }, { 631, 1906 }, { 633, 1266 }, { 634, 754 }, { 635, 1778 }, { 637, 1522 },
+    { 638, 1010 }, { 639, 2034 }, { 641, 1034 }, { 643, 1546 }, { 645, 1290 }, { 646, 778 }, { 647, 1802 }, { 649, 1162 },
+    { 651, 1674 }, { 653, 1418 }, { 654, 906 }, { 655, 1930 }, { 657, 1098 }, { 659, 1610 }, { 661, 1354 }, { 662, 842 },
+    { 663, 1866 }, { 665, 1226 }, { 666, 714 }, { 667, 1738 }, { 669, 1482 }, { 670, 970 }, { 671, 1994 }, { 673, 1066 },
+    { 675, 1578 }, { 677, 1322 }, { 678, 810 }, { 679, 1834 }, { 681, 1194 }, { 683, 1706 }, { 685, 1450 }, { 686, 938 },
+    { 687, 1962 }, { 689, 1130 }, { 691, 1642 }, { 693, 1386 }, { 694, 874 }, { 695, 1898 }, { 697, 1258 }, { 698, 746 },
+    { 699, 1770 }, { 701, 1514 }, { 702, 1002 }, { 703, 2026 }, { 705, 1050 }, { 707, 1562 }, { 709, 1306 }, { 710, 794 },
+    { 711, 1818 }, { 713, 1178 }, { 715, 1690 }, { 717, 1434 }, { 718, 922 }, { 719, 1946 }, { 721, 1114 }, { 723, 1626 },
+    { 725, 1370 }, { 726, 858 }, { 727, 1882 }, { 729, 1242 }, { 731, 1754 }, { 733, 1498 }, { 734, 986 }, { 735, 2010 },
+    { 737, 1082 }, { 739, 1594 }, { 741, 1338 }, { 742, 826 }, { 743, 1850 }, { 745, 1210 }, { 747, 1722 }, { 749, 1466 },
+    { 750, 954 }, { 751, 1978 }, { 753, 1146 }, { 755, 1658 }, { 757, 1402 }, { 758, 890 }, { 759, 1914 }, { 761, 1274 },
+    { 763, 1786 }, { 765, 1530 }, { 766, 1018 }, { 767, 2042 }, { 769, 1030 }, { 771, 1542 }, { 773, 1286 }, { 775, 1798 },
+    { 777, 1158 }, { 779, 1670 }, { 781, 1414 }, { 782, 902 }, { 783, 1926 }, { 785, 1094 }, { 787, 1606 }, { 789, 1350 },
+    { 790, 838 }, { 791, 1862 }, { 793, 1222 }, { 795, 1734 }, { 797, 1478 }, { 798, 966 }, { 799, 1990 }, { 801, 1062 },
+    { 803, 1574 }, { 805, 1318 }, { 807, 1830 }, { 809, 1190 }, { 811, 1702 }, { 813, 1446 }, { 814, 934 }, { 815, 1958 },
+    { 817, 1126 }, { 819, 1638 }, { 821, 1382 }, { 822, 870 }, { 823, 1894 }, { 825, 1254 }, { 827, 1766 }, { 829, 1510 },
+    { 830, 998 }, { 831, 2022 }, { 833, 1046 }, { 835, 1558 }, { 837, 1302 }, { 839, 1814 }, { 841, 1174 }, { 843, 1686 },
+    { 845, 1430 }, { 846, 918 }, { 847, 1942 }, { 849, 1110 }, { 851, 1622 }, { 853, 1366 }, { 855, 1878 }, { 857, 1238 },
+    { 859, 1750 }, { 861, 1494 }, { 862, 982 }, { 863, 2006 }, { 865, 1078 }, { 867, 1590 }, { 869, 1334 }, { 871, 1846 },
+    { 873, 1206 }, { 875, 1718 }, { 877, 1462 }, { 878, 950 }, { 879, 1974 }, { 881, 1142 }, { 883, 1654 }, { 885, 1398 },
+    { 887, 1910 }, { 889, 1270 }, { 891, 1782 }, { 893, 1526 }, { 894, 1014 }, { 895, 2038 }, { 897, 1038 }, { 899, 1550 },
+    { 901, 1294 }, { 903, 1806 }, { 905, 1166 }, { 907, 1678 }, { 909, 1422 }, { 911, 1934 }, { 913, 1102 }, { 915, 1614 },
+    { 917, 1358 }, { 919, 1870 }, { 921, 1230 }, { 923, 1742 }, { 925, 1486 }, { 926, 974 }, { 927, 1998 }, { 929, 1070 },
+    { 931, 1582 }, { 933, 1326 }, { 935, 1838 }, { 937, 1198 }, { 939, 1710 }, { 941, 1454 }, { 943, 1966 }, { 945, 1134 },
+    { 947, 1646 }, { 949, 1390 }, { 951, 1902 }, { 953, 1262 }, { 955, 1774 }, { 957, 1518 }, { 958, 1006 }, { 959, 2030 },
+    { 961, 1054 }, { 963, 1566 }, { 965, 1310 }, { 967, 1822 }, { 969, 1182 }, { 971, 1694 }, { 973, 1438 }, { 975, 1950 },
+    { 977, 1118 }, { 979, 1630 }, { 981, 1374 }, { 983, 1886 }, { 985, 1246 }, { 987, 1758 }, { 989, 1502 }, { 991, 2014 },
+    { 993, 1086 }, { 995, 1598 }, { 997, 1342 }, { 999, 1854 }, { 1001, 1214 }, { 1003, 1726 }, { 1005, 1470 }, { 1007, 1982 },
+    { 1009, 1150 }, { 1011, 1662 }, { 1013, 1406 }, { 1015, 1918 }, { 1017, 1278 }, { 1019, 1790 }, { 1021, 1534 }, { 1023, 2046 },
+    { 1027, 1537 }, { 1029, 1281 }, { 1031, 1793 }, { 1033, 1153 }, { 1035, 1665 }, { 1037, 1409 }, { 1039, 1921 }, { 1041, 1089 },
+    { 1043, 1601 }, { 1045, 1345 }, { 1047, 1857 }, { 1049, 1217 }, { 1051, 1729 }, { 1053, 1473 }, { 1055, 1985 }, { 1059, 1569 },
+    { 1061, 1313 }, { 1063, 1825 }, { 1065, 1185 }, { 1067, 1697 }, { 1069, 1441 }, { 1071, 1953 }, { 1073, 1121 }, { 1075, 1633 },
+    { 1077, 1377 }, { 1079, 1889 }, { 1081, 1249 }, { 1083, 1761 }, { 1085, 1505 }, { 1087, 2017 }, { 1091, 1553 }, { 1093, 1297 },
+    { 1095, 1809 }, { 1097, 1169 }, { 1099, 1681 }, { 1101, 1425 }, { 1103, 1937 }, { 1107, 1617 }, { 1109, 1361 }, { 1111, 1873 },
+    { 1113, 1233 }, { 1115, 1745 }, { 1117, 1489 }, { 1119, 2001 }, { 1123, 1585 }, { 1125, 1329 }, { 1127, 1841 }, { 1129, 1201 },
+    { 1131, 1713 }, { 1133, 1457 }, { 1135, 1969 }, { 1139, 1649 }, { 1141, 1393 }, { 1143, 1905 }, { 1145, 1265 }, { 1147, 1777 },
+    { 1149, 1521 }, { 1151, 2033 }, { 1155, 1545 }, { 1157, 1289 }, { 1159, 1801 }, { 1163, 1673 }, { 1165, 1417 }, { 1167, 1929 },
+    { 1171, 1609 }, { 1173, 1353 }, { 1175, 1865 }, { 1177, 1225 }, { 1179, 1737 }, { 1181, 1481 }, { 1183, 1993 }, { 1187, 1577 },
+    { 1189, 1321 }, { 1191, 1833 }, { 1195, 1705 }, { 1197, 1449 }, { 1199, 1961 }, { 1203, 1641 }, { 1205, 1385 }, { 1207, 1897 },
+    { 1209, 1257 }, { 1211, 1769 }, { 1213, 1513 }, { 1215, 2025 }, { 1219, 1561 }, { 1221, 1305 }, { 1223, 1817 }, { 1227, 1689 },
+    { 1229, 1433 }, { 1231, 1945 }, { 1235, 1625 }, { 1237, 1369 }, { 1239, 1881 }, { 1243, 1753 }, { 1245, 1497 }, { 1247, 2009 },
+    { 1251, 1593 }, { 1253, 1337 }, { 1255, 1849 }, { 1259, 1721 }, { 1261, 1465 }, { 1263, 1977 }, { 1267, 1657 }, { 1269, 1401 },
+    { 1271, 1913 }, { 1275, 1785 }, { 1277, 1529 }, { 1279, 2041 }, { 1283, 1541 }, { 1287, 1797 }, { 1291, 1669 }, { 1293, 1413 },
+    { 1295, 1925 }, { 1299, 1605 }, { 1301, 1349 }, { 1303, 1861 }, { 1307, 1733 }, { 1309, 1477 }, { 1311, 1989 }, { 1315, 1573 },
+    { 1319, 1829 }, { 1323, 1701 }, { 1325, 1445 }, { 1327, 1957 }, { 1331, 1637 }, { 1333, 1381 }, { 1335, 1893 }, { 1339, 1765 },
+    { 1341, 1509 }, { 1343, 2021 }, { 1347, 1557 }, { 1351, 1813 }, { 1355, 1685 }, { 1357, 1429 }, { 1359, 1941 }, { 1363, 1621 },
+    { 1367, 1877 }, { 1371, 1749 }, { 1373, 1493 }, { 1375, 2005 }, { 1379, 1589 }, { 1383, 1845 }, { 1387, 1717 }, { 1389, 1461 },
+    { 1391, 1973 }, { 1395, 1653 }, { 1399, 1909 }, { 1403, 1781 }, { 1405, 1525 }, { 1407, 2037 }, { 1411, 1549 }, { 1415, 1805 },
+    { 1419, 1677 }, { 1423, 1933 }, { 1427, 1613 }, { 1431, 1869 }, { 1435, 1741 }, { 1437, 1485 }, { 1439, 1997 }, { 1443, 1581 },
+    { 1447, 1837 }, { 1451, 1709 }, { 1455, 1965 }, { 1459, 1645 }, { 1463, 1901 }, { 1467, 1773 }, { 1469, 1517 }, { 1471, 2029 },
+    { 1475, 1565 }, { 1479, 1821 }, { 1483, 1693 }, { 1487, 1949 }, { 1491, 1629 }, { 1495, 1885 }, { 1499, 1757 }, { 1503, 2013 },
+    { 1507, 1597 }, { 1511, 1853 }, { 1515, 1725 }, { 1519, 1981 }, { 1523, 1661 }, { 1527, 1917 }, { 1531, 1789 }, { 1535, 2045 },
+    { 1543, 1795 }, { 1547, 1667 }, { 1551, 1923 }, { 1555, 1603 }, { 1559, 1859 }, { 1563, 1731 }, { 1567, 1987 }, { 1575, 1827 },
+    { 1579, 1699 }, { 1583, 1955 }, { 1587, 1635 }, { 1591, 1891 }, { 1595, 1763 }, { 1599, 2019 }, { 1607, 1811 }, { 1611, 1683 },
+    { 1615, 1939 }, { 1623, 1875 }, { 1627, 1747 }, { 1631, 2003 }, { 1639, 1843 }, { 1643, 1715 }, { 1647, 1971 }, { 1655, 1907 },
+    { 1659, 1779 }, { 1663, 2035 }, { 1671, 1803 }, { 1679, 1931 }, { 1687, 1867 }, { 1691, 1739 }, { 1695, 1995 }, { 1703, 1835 },
+    { 1711, 1963 }, { 1719, 1899 }, { 1723, 1771 }, { 1727, 2027 }, { 1735, 1819 }, { 1743, 1947 }, { 1751, 1883 }, { 1759, 2011 },
+    { 1767, 1851 }, { 1775, 1979 }, { 1783, 1915 }, { 1791, 2043 }, { 1807, 1927 }, { 1815, 1863 }, { 1823, 1991 }, { 1839, 1959 },
+    { 1847, 1895 }, { 1855, 2023 }, { 1871, 1943 }, { 1887, 2007 }, { 1903, 1975 }, { 1919, 2039 }, { 1951, 1999 }, { 1983, 2031 },
+};
+
+const uint16_t FFT_BitReverseTableHalf[FFT_BIT_REVERSE_HALF_SWAPS][2] =
+{
+    { 1, 512 }, { 2, 256 }, { 3, 768 }, { 4, 128 }, { 5, 640 }, { 6, 384 }, { 7, 896 }, { 8, 64 },
+    { 9, 576 }, { 10, 320 }, { 11, 832 }, { 12, 192 }, { 13, 704 }, { 14, 448 }, { 15, 960 }, { 16, 32 },
+    { 17, 544 }, { 18, 288 }, { 19, 800 }, { 20, 160 }, { 21, 672 }, { 22, 416 }, { 23, 928 }, { 24, 96 },
+    { 25, 608 }, { 26, 352 }, { 27, 864 }, { 28, 224 }, { 29, 736 }, { 30, 480 }, { 31, 992 }, { 33, 528 },
+    { 34, 272 }, { 35, 784 }, { 36, 144 }, { 37, 656 }, { 38, 400 }, { 39, 912 }, { 40, 80 }, { 41, 592 },
+    { 42, 336 }, { 43, 848 }, { 44, 208 }, { 45, 720 }, { 46, 464 }, { 47, 976 }, { 49, 560 }, { 50, 304 },
+    { 51, 816 }, { 52, 176 }, { 53, 688 }, { 54, 432 }, { 55, 944 }, { 56, 112 }, { 57, 624 }, { 58, 368 },
+    { 59, 880 }, { 60, 240 }, { 61, 752 }, { 62, 496 }, { 63, 1008 }, { 65, 520 }, { 66, 264 }, { 67, 776 },
+    { 68, 136 }, { 69, 648 }, { 70, 392 }, { 71, 904 }, { 73, 584 }, { 74, 328 }, { 75, 840 }, { 76, 200 },
+    { 77, 712 }, { 78, 456 }, { 79, 968 }, { 81, 552 }, { 82, 296 }, { 83, 808 }, { 84, 168 }, { 85, 680 },
+    { 86, 424 }, { 87, 936 }, { 88, 104 }, { 89, 616 }, { 90, 360 }, { 91, 872 }, { 92, 232 }, { 93, 744 },
+    { 94, 488 }, { 95, 1000 }, { 97, 536 }, { 98, 280 }, { 99, 792 }, { 100, 152 }, { 101, 664 }, { 102, 408 },
+    { 103, 920 }, { 105, 600 }, { 106, 344 }, { 107, 856 }, { 108, 216 }, { 109, 728 }, { 110, 472 }, { 111, 984 },
+    { 113, 568 }, { 114, 312 }, { 115, 824 }, { 116, 184 }, { 117, 696 }, { 118, 440 }, { 119, 952 }, { 121, 632 },
+    { 122, 376 }, { 123, 888 }, { 124, 248 }, { 125, 760 }, { 126, 504 }, { 127, 1016 }, { 129, 516 }, { 130, 260 },
+    { 131, 772 }, { 133, 644 }, { 134, 388 }, { 135, 900 }, { 137, 580 }, { 138, 324 }, { 139, 836 }, { 140, 196 },
+    { 141, 708 }, { 142, 452 }, { 143, 964 }, { 145, 548 }, { 146, 292 }, { 147, 804 }, { 148, 164 }, { 149, 676 },
+    { 150, 420 }, { 151, 932 }, { 153, 612 }, { 154, 356 }, { 155, 868 }, { 156, 228 }, { 157, 740 }, { 158, 484 },
+    { 159, 996 }, { 161, 532 }, { 162, 276 }, { 163, 788 }, { 165, 660 }, { 166, 404 }, { 167, 916 }, { 169, 596 },
+    { 170, 340 }, { 171, 852 }, { 172, 212 }, { 173, 724 }, { 174, 468 }, { 175, 980 }, { 177, 564 }, { 178, 308 },
+    { 179, 820 }, { 181, 692 }, { 182, 436 }, { 183, 948 }, { 185, 628 }, { 186, 372 }, { 187, 884 }, { 188, 244 },
+    { 189, 756 }, { 190, 500 }, { 191, 1012 }, { 193, 524 }, { 194, 268 }, { 195, 780 }, { 197, 652 }, { 198, 396 },
+    { 199, 908 }, { 201, 588 }, { 202, 332 }, { 203, 844 }, { 205, 716 }, { 206, 460 }, { 207, 972 }, { 209, 556 },
+    { 210, 300 }, { 211, 812 }, { 213, 684 }, { 214, 428 }, { 215, 940 }, { 217, 620 }, { 218, 364 }, { 219, 876 },
+    { 220, 236 }, { 221, 748 }, { 222, 492 }, { 223, 1004 }, { 225, 540 }, { 226, 284 }, { 227, 796 }, { 229, 668 },
+    { 230, 412 }, { 231, 924 }, { 233, 604 }, { 234, 348 }, { 235, 860 }, { 237, 732 }, { 238, 476 }, { 239, 988 },
+    { 241, 572 }, { 242, 316 }, { 243, 828 }, { 245, 700 }, { 246, 444 }, { 247, 956 }, { 249, 636 }, { 250, 380 },
+    { 251, 892 }, { 253, 764 }, { 254, 508 }, { 255, 1020 }, { 257, 514 }, { 259, 770 }, { 261, 642 }, { 262, 386 },
+    { 263, 898 }, { 265, 578 }, { 266, 322 }, { 267, 834 }, { 269, 706 }, { 270, 450 }, { 271, 962 }, { 273, 546 },
+    { 274, 290 }, { 275, 802 }, { 277, 674 }, { 278, 418 }, { 279, 930 }, { 281, 610 }, { 282, 354 }, { 283, 866 },
+    { 285, 738 }, { 286, 482 }, { 287, 994 }, { 289, 530 }, { 291, 786 }, { 293, 658 }, { 294, 402 }, { 295, 914 },
+    { 297, 594 }, { 298, 338 }, { 299, 850 }, { 301, 722 }, { 302, 466 }, { 303, 978 }, { 305, 562 }, { 307, 818 },
+    { 309, 690 }, { 310, 434 }, { 311, 946 }, { 313, 626 }, { 314, 370 }, { 315, 882 }, { 317, 754 }, { 318, 498 },
+    { 319, 1010 }, { 321, 522 }, { 323, 778 }, { 325, 650 }, { 326, 394 }, { 327, 906 }, { 329, 586 }, { 331, 842 },
+    { 333, 714 }, { 334, 458 }, { 335, 970 }, { 337, 554 }, { 339, 810 }, { 341, 682 }, { 342, 426 }, { 343, 938 },
+    { 345, 618 }, { 346, 362 }, { 347, 874 }, { 349, 746 }, { 350, 490 }, { 351, 1002 }, { 353, 538 }, { 355, 794 },
+    { 357, 666 }, { 358, 410 }, { 359, 922 }, { 361, 602 }, { 363, 858 }, { 365, 730 }, { 366, 474 }, { 367, 986 },
+    { 369, 570 }, { 371, 826 }, { 373, 698 }, { 374, 442 }, { 375, 954 }, { 377, 634 }, { 379, 890 }, { 381, 762 },
+    { 382, 506 }, { 383, 1018 }, { 385, 518 }, { 387, 774 }, { 389, 646 }, { 391, 902 }, { 393, 582 }, { 395, 838 },
+    { 397, 710 }, { 398, 454 }, { 399, 966 }, { 401, 550 }, { 403, 806 }, { 405, 678 }, { 406, 422 }, { 407, 934 },
+    { 409, 614 }, { 411, 870 }, { 413, 742 }, { 414, 486 }, { 415, 998 }, { 417, 534 }, { 419, 790 }, { 421, 662 },
+    { 423, 918 }, { 425, 598 }, { 427, 854 }, { 429, 726 }, { 430, 470 }, { 431, 982 }, { 433, 566 }, { 435, 822 },
+    { 437, 694 }, { 439, 950 }, { 441, 630 }, { 443, 886 }, { 445, 758 }, { 446, 502 }, { 447, 1014 }, { 449, 526 },
+    { 451, 782 }, { 453, 654 }, { 455, 910 }, { 457, 590 }, { 459, 846 }, { 461, 718 }, { 463, 974 }, { 465, 558 },
+    { 467, 814 }, { 469, 686 }, { 471, 942 }, { 473, 622 }, { 475, 878 }, { 477, 750 }, { 478, 494 }, { 479, 1006 },
+    { 481, 542 }, { 483, 798 }, { 485, 670 }, { 487, 926 }, { 489, 606 }, { 491, 862 }, { 493, 734 }, { 495, 990 },
+    { 497, 574 }, { 499, 830 }, { 501, 702 }, { 503, 958 }, { 505, 638 }, { 507, 894 }, { 509, 766 }, { 511, 1022 },
+    { 515, 769 }, { 517, 641 }, { 519, 897 }, { 521, 577 }, { 523, 833 }, { 525, 705 }, { 527, 961 }, { 529, 545 },
+    { 531, 801 }, { 533, 673 }, { 535, 929 }, { 537, 609 }, { 539, 865 }, { 541, 737 }, { 543, 993 }, { 547, 785 },
+    { 549, 657 }, { 551, 913 }, { 553, 593 }, { 555, 849 }, { 557, 721 }, { 559, 977 }, { 563, 817 }, { 565, 689 },
+    { 567, 945 }, { 569, 625 }, { 571, 881 }, { 573, 753 }, { 575, 1009 }, { 579, 777 }, { 581, 649 }, { 583, 905 },
+    { 587, 841 }, { 589, 713 }, { 591, 969 }, { 595, 809 }, { 597, 681 }, { 599, 937 }, { 601, 617 }, { 603, 873 },
+    { 605, 745 }, { 607, 1001 }, { 611, 793 }, { 613, 665 }, { 615, 921 }, { 619, 857 }, { 621, 729 }, { 623, 985 },
+    { 627, 825 }, { 629, 697 }, { 631, 953 }, { 635, 889 }, { 637, 761 }, { 639, 1017 }, { 643, 773 }, { 647, 901 },
+    { 651, 837 }, { 653, 709 }, { 655, 965 }, { 659, 805 }, { 661, 677 }, { 663, 933 }, { 667, 869 }, { 669, 741 },
+    { 671, 997 }, { 675, 789 }, { 679, 917 }, { 683, 853 }, { 685, 725 }, { 687, 981 }, { 691, 821 }, { 695, 949 },
+    { 699, 885 }, { 701, 757 }, { 703, 1013 }, { 707, 781 }, { 711, 909 }, { 715, 845 }, { 719, 973 }, { 723, 813 },
+    { 727, 941 }, { 731, 877 }, { 733, 749 }, { 735, 1005 }, { 739, 797 }, { 743, 925 }, { 747, 861 }, { 751, 989 },
+    { 755, 829 }, { 759, 957 }, { 763, 893 }, { 767, 1021 }, { 775, 899 }, { 779, 835 }, { 783, 963 }, { 787, 803 },
+    { 791, 931 }, { 795, 867 }, { 799, 995 }, { 807, 915 }, { 811, 851 }, { 815, 979 }, { 823, 947 }, { 827, 883 },
+    { 831, 1011 }, { 839, 907 }, { 847, 971 }, { 855, 939 }, { 859, 875 }, { 863, 1003 }, { 871, 923 }, { 879, 987 },
+    { 887, 955 }, { 895, 1019 }, { 911, 967 }, { 919, 935 }, { 927, 999 }, { 943, 983 }, { 959, 1015 }, { 991, 1007 },
+};
+
+const float FFT_WindowTable[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2] =
+{
+    /* Hamming */
+    {
+        0.08f, 0.080002167f, 0.0800086678f, 0.0800195025f,
+        0.080034671f, 0.0800541731f, 0.0800780085f, 0.0801061772f,
+        0.0801386788f, 0.080175513f, 0.0802166795f, 0.0802621779f,
+        0.0803120077f, 0.0803661685f, 0.0804246598f, 0.080487481f,
+        0.0805546315f, 0.0806261108f, 0.0807019181f, 0.0807820527f,
+        0.0808665138f, 0.0809553007f, 0.0810484125f, 0.0811458484f,
+        0.0812476074f, 0.0813536886f, 0.081464091f, 0.0815788135f,
+        0.081697855f, 0.0818212145f, 0.0819488908f, 0.0820808826f,
+        0.0822171887f, 0.0823578079f, 0.0825027387f, 0.08265198f,
+        0.0828055301f, 0.0829633878f, 0.0831255514f, 0.0832920196f,
+        0.0834627906f, 0.083637863f, 0.083817235f, 0.084000905f,
+        0.0841888712f, 0.0843811319f, 0.0845776852f, 0.0847785293f,
+        0.0849836623f, 0.0851930823f, 0.0854067873f, 0.0856247752f,
+        0.0858470441f, 0.0860735919f, 0.0863044163f, 0.0865395153f,
+        0.0867788866f, 0.087022528f, 0.0872704371f, 0.0875226116f,
+        0.0877790492f, 0.0880397474f, 0.0883047038f, 0.0885739159f,
+        0.0888473812f, 0.089125097f, 0.0894070607f, 0.0896932698f,
+        0.0899837214f, 0.090278413f, 0.0905773416f, 0.0908805045f,
+        0.0911878987f, 0.0914995216f, 0.09181537f, 0.092135441f,
+        0.0924597316f, 0.0927882387f, 0.0931209593f, 0.0934578901f,
+        0.0937990282f, 0.0941443701f, 0.0944939127f, 0.0948476526f,
+        0.0952055866f, 0.0955677113f, 0.0959340232f, 0.096304519f,
+        0.096679195f, 0.0970580478f, 0.0974410739f, 0.0978282695f,
+        0.0982196311f, 0.0986151549f, 0.0990148373f, 0.0994186745f,
+        0.0998266627f, 0.100238798f, 0.100655076f, 0.101075494f,
+        0.101500048f, 0.101928732f, 0.102361544f, 0.102798479f,
+        0.103239533f, 0.103684703f, 0.104133983f, 0.104587369f,
+        0.105044858f, 0.105506445f, 0.105972125f, 0.106441895f,
+        0.106915749f, 0.107393684f, 0.107875695f, 0.108361777f,
+        0.108851925f, 0.109346136f, 0.109844404f, 0.110346725f,
+        0.110853094f, 0.111363506f, 0.111877957f, 0.112396441f,
+        0.112918954f, 0.113445491f, 0.113976046f, 0.114510615f,
+        0.115049194f, 0.115591775f, 0.116138356f, 0.11668893f,
+        0.117243492f, 0.117802037f, 0.11836456f, 0.118931055f,
+        0.119501518f, 0.120075942f, 0.120654322f, 0.121236654f,
+        0.121822931f, 0.122413148f, 0.123007299f, 0.123605379f,
+        0.124207382f, 0.124813302f, 0.125423134f, 0.126036872f,
+        0.12665451f, 0.127276043f, 0.127901464f, 0.128530768f,
+        0.129163948f, 0.129801f, 0.130441915f, 0.13108669f,
+        0.131735317f, 0.132387791f, 0.133044105f, 0.133704253f,
+        0.134368229f, 0.135036027f, 0.13570764f, 0.136383063f,
+        0.137062288f, 0.137745309f, 0.13843212f, 0.139122715f,
+        0.139817086f, 0.140515228f, 0.141217134f, 0.141922797f,
+        0.14263221f, 0.143345367f, 0.144062261f, 0.144782886f,
+        0.145507234f, 0.146235299f, 0.146967074f, 0.147702552f,
+        0.148441726f, 0.149184589f, 0.149931134f, 0.150681354f,
+        0.151435242f, 0.152192791f, 0.152953994f, 0.153718843f,
+        0.154487332f, 0.155259453f, 0.156035198f, 0.156814562f,
+        0.157597535f, 0.158384112f, 0.159174283f, 0.159968043f,
+        0.160765383f, 0.161566297f, 0.162370775f, 0.163178812f,
+        0.163990399f, 0.164805528f, 0.165624192f, 0.166446384f,
+        0.167272095f, 0.168101318f, 0.168934044f, 0.169770267f,
+        0.170609978f, 0.171453169f, 0.172299832f, 0.173149959f,
+        0.174003543f, 0.174860575f, 0.175721048f, 0.176584952f,
+        0.177452281f, 0.178323025f, 0.179197176f, 0.180074728f,
+        0.18095567f, 0.181839995f, 0.182727694f, 0.183618759f,
+        0.184513182f, 0.185410955f, 0.186312068f, 0.187216513f,
+        0.188124282f, 0.189035367f, 0.189949758f, 0.190867447f,
+        0.191788425f, 0.192712684f, 0.193640215f, 0.19457101f,
+        0.195505059f, 0.196442353f, 0.197382885f, 0.198326644f,
+        0.199273623f, 0.200223811f, 0.201177201f, 0.202133783f,
+        0.203093549f, 0.204056488f, 0.205022593f, 0.205991854f,
+        0.206964261f, 0.207939807f, 0.208918481f, 0.209900274f,
+        0.210885177f, 0.211873181f, 0.212864277f, 0.213858454f,
+        0.214855705f, 0.215856018f, 0.216859386f, 0.217865798f,
+        0.218875246f, 0.219887718f, 0.220903207f, 0.221921702f,
+        0.222943194f, 0.223967673f, 0.22499513f, 0.226025554f,
+        0.227058937f, 0.228095268f, 0.229134537f, 0.230176736f,
+        0.231221853f, 0.23226988f, 0.233320806f, 0.234374621f,
+        0.235431316f, 0.23649088f, 0.237553304f, 0.238618578f,
+        0.239686691f, 0.240757633f, 0.241831394f, 0.242907965f,
+        0.243987335f, 0.245069494f, 0.246154432f, 0.247242138f,
+        0.248332602f, 0.249425814f, 0.250521764f, 0.251620442f,
+        0.252721836f, 0.253825937f, 0.254932734f, 0.256042217f,
+        0.257154375f, 0.258269198f, 0.259386675f, 0.260506797f,
+        0.261629551f, 0.262754928f, 0.263882918f, 0.265013508f,
+        0.26614669f, 0.267282452f, 0.268420783f, 0.269561672f,
+        0.27070511f, 0.271851085f, 0.272999587f, 0.274150603f,
+        0.275304125f, 0.276460141f, 0.277618639f, 0.278779609f,
+        0.279943041f, 0.281108923f, 0.282277244f, 0.283447993f,
+        0.284621159f, 0.285796731f, 0.286974698f, 0.28815505f,
+        0.289337773f, 0.290522859f, 0.291710295f, 0.29290007f,
+        0.294092174f, 0.295286594f, 0.29648332f, 0.29768234f,
+        0.298883643f, 0.300087218f, 0.301293053f, 0.302501137f,
+        0.303711459f, 0.304924007f, 0.30613877f, 0.307355736f,
+        0.308574894f, 0.309796232f, 0.31101974f, 0.312245404f,
+        0.313473215f, 0.31470316f, 0.315935227f, 0.317169405f,
+        0.318405683f, 0.319644049f, 0.32088449f, 0.322126996f,
+        0.323371555f, 0.324618155f, 0.325866784f, 0.32711743f,
+        0.328370083f, 0.329624729f, 0.330881357f, 0.332139955f,
+        0.333400512f, 0.334663015f, 0.335927453f, 0.337193814f,
+        0.338462085f, 0.339732255f, 0.341004312f, 0.342278244f,
+        0.343554038f, 0.344831684f, 0.346111168f, 0.347392479f,
+        0.348675604f, 0.349960533f, 0.351247251f, 0.352535748f,
+        0.353826012f, 0.355118029f, 0.356411788f, 0.357707277f,
+        0.359004483f, 0.360303395f, 0.361604f, 0.362906285f,
+        0.364210239f, 0.365515849f, 0.366823103f, 0.368131989f,
+        0.369442494f, 0.370754606f, 0.372068312f, 0.373383601f,
+        0.374700459f, 0.376018875f, 0.377338836f, 0.378660329f,
+        0.379983342f, 0.381307863f, 0.382633879f, 0.383961378f,
+        0.385290347f, 0.386620773f, 0.387952645f, 0.389285949f,
+        0.390620673f, 0.391956804f, 0.39329433f, 0.394633239f,
+        0.395973517f, 0.397315151f, 0.398658131f, 0.400002442f,
+        0.401348072f, 0.402695008f, 0.404043238f, 0.405392748f,
+        0.406743527f, 0.408095562f, 0.409448839f, 0.410803346f,
+        0.412159071f, 0.413516f, 0.41487412f, 0.41623342f,
+        0.417593886f, 0.418955504f, 0.420318264f, 0.42168215f,
+        0.423047152f, 0.424413256f, 0.425780448f, 0.427148717f,
+        0.428518049f, 0.429888431f, 0.43125985f, 0.432632294f,
+        0.43400575f, 0.435380204f, 0.436755644f, 0.438132057f,
+        0.43950943f, 0.440887749f, 0.442267002f, 0.443647176f,
+        0.445028258f, 0.446410234f, 0.447793092f, 0.449176819f,
+        0.450561402f, 0.451946827f, 0.453333082f, 0.454720153f,
+        0.456108028f, 0.457496694f, 0.458886136f, 0.460276343f,
+        0.461667301f, 0.463058997f, 0.464451418f, 0.46584455f,
+        0.467238382f, 0.468632899f, 0.470028088f, 0.471423936f,
+        0.472820431f, 0.474217559f, 0.475615306f, 0.47701366f,
+        0.478412607f, 0.479812135f, 0.481212229f, 0.482612878f,
+        0.484014067f, 0.485415784f, 0.486818015f, 0.488220747f,
+        0.489623966f, 0.491027661f, 0.492431817f, 0.493836421f,
+        0.49524146f, 0.49664692f, 0.49805279f, 0.499459054f,
+        0.5008657f, 0.502272715f, 0.503680086f, 0.505087798f,
+        0.50649584f, 0.507904197f, 0.509312857f, 0.510721805f,
+        0.51213103f, 0.513540517f, 0.514950254f, 0.516360226f,
+        0.517770421f, 0.519180826f, 0.520591427f, 0.52200221f,
+        0.523413163f, 0.524824273f, 0.526235525f, 0.527646907f,
+        0.529058406f, 0.530470008f, 0.531881699f, 0.533293467f,
+        0.534705298f, 0.536117179f, 0.537529096f, 0.538941037f,
+        0.540352988f, 0.541764935f, 0.543176866f, 0.544588767f,
+        0.546000625f, 0.547412426f, 0.548824157f, 0.550235805f,
+        0.551647357f, 0.553058799f, 0.554470118f, 0.555881301f,
+        0.557292334f, 0.558703204f, 0.560113898f, 0.561524402f,
+        0.562934703f, 0.564344789f, 0.565754645f, 0.567164258f,
+        0.568573616f, 0.569982704f, 0.57139151f, 0.57280002f,
+        0.574208221f, 0.5756161f, 0.577023643f, 0.578430838f,
+        0.57983767f, 0.581244127f, 0.582650195f, 0.584055862f,
+        0.585461113f, 0.586865936f, 0.588270318f, 0.589674245f,
+        0.591077704f, 0.592480681f, 0.593883164f, 0.59528514f,
+        0.596686594f, 0.598087515f, 0.599487888f, 0.600887701f,
+        0.60228694f, 0.603685592f, 0.605083644f, 0.606481084f,
+        0.607877896f, 0.609274069f, 0.61066959f, 0.612064445f,
+        0.61345862f, 0.614852104f, 0.616244882f, 0.617636942f,
+        0.619028271f, 0.620418855f, 0.621808681f, 0.623197737f,
+        0.624586009f, 0.625973484f, 0.627360148f, 0.62874599f,
+        0.630130996f, 0.631515152f, 0.632898446f, 0.634280865f,
+        0.635662396f, 0.637043025f, 0.63842274f, 0.639801528f,
+        0.641179376f, 0.64255627f, 0.643932198f, 0.645307147f,
+        0.646681103f, 0.648054055f, 0.649425988f, 0.650796891f,
+        0.652166749f, 0.653535551f, 0.654903284f, 0.656269933f,
+        0.657635487f, 0.658999933f, 0.660363258f, 0.661725448f,
+        0.663086492f, 0.664446376f, 0.665805088f, 0.667162614f,
+        0.668518943f, 0.66987406f, 0.671227954f, 0.672580611f,
+        0.67393202f, 0.675282166f, 0.676631038f, 0.677978623f,
+        0.679324907f, 0.680669879f, 0.682013526f, 0.683355835f,
+        0.684696793f, 0.686036388f, 0.687374606f, 0.688711437f,
+        0.690046866f, 0.691380882f, 0.692713471f, 0.694044622f,
+        0.695374321f, 0.696702556f, 0.698029315f, 0.699354585f,
+        0.700678354f, 0.702000609f, 0.703321337f, 0.704640527f,
+        0.705958166f, 0.707274241f, 0.70858874f, 0.70990165f,
+        0.71121296f, 0.712522657f, 0.713830729f, 0.715137162f,
+        0.716441946f, 0.717745067f, 0.719046514f, 0.720346273f,
+        0.721644334f, 0.722940683f, 0.724235308f, 0.725528198f,
+        0.72681934f, 0.728108722f, 0.729396331f, 0.730682156f,
+        0.731966184f, 0.733248404f, 0.734528803f, 0.73580737f,
+        0.737084091f, 0.738358956f, 0.739631952f, 0.740903067f,
+        0.742172289f, 0.743439606f, 0.744705007f, 0.745968479f,
+        0.74723001f, 0.74848959f, 0.749747204f, 0.751002843f,
+        0.752256493f, 0.753508144f, 0.754757783f, 0.756005399f,
+        0.75725098f, 0.758494514f, 0.759735989f, 0.760975394f,
+        0.762212718f, 0.763447947f, 0.764681071f, 0.765912079f,
+        0.767140958f, 0.768367697f, 0.769592284f, 0.770814709f,
+        0.772034958f, 0.773253022f, 0.774468888f, 0.775682545f,
+        0.776893981f, 0.778103185f, 0.779310146f, 0.780514853f,
+        0.781717293f, 0.782917456f, 0.784115331f, 0.785310905f,
+        0.786504168f, 0.787695109f, 0.788883716f, 0.790069978f,
+        0.791253884f, 0.792435423f, 0.793614584f, 0.794791355f,
+        0.795965726f, 0.797137685f, 0.798307221f, 0.799474324f,
+        0.800638982f, 0.801801184f, 0.80296092f, 0.804118178f,
+        0.805272948f, 0.806425219f, 0.807574979f, 0.808722219f,
+        0.809866926f, 0.811009092f, 0.812148703f, 0.813285751f,
+        0.814420224f, 0.815552112f, 0.816681403f, 0.817808087f,
+        0.818932155f, 0.820053594f, 0.821172394f, 0.822288546f,
+        0.823402038f, 0.82451286f, 0.825621001f, 0.826726451f,
+        0.8278292f, 0.828929237f, 0.830026552f, 0.831121135f,
+        0.832212974f, 0.833302061f, 0.834388384f, 0.835471933f,
+        0.836552699f, 0.837630671f, 0.838705838f, 0.839778191f,
+        0.84084772f, 0.841914415f, 0.842978265f, 0.84403926f,
+        0.845097391f, 0.846152647f, 0.847205019f, 0.848254497f,
+        0.84930107f, 0.850344729f, 0.851385464f, 0.852423266f,
+        0.853458124f, 0.854490028f, 0.85551897f, 0.856544939f,
+        0.857567926f, 0.858587921f, 0.859604914f, 0.860618896f,
+        0.861629857f, 0.862637788f, 0.863642679f, 0.864644521f,
+        0.865643304f, 0.866639019f, 0.867631657f, 0.868621208f,
+        0.869607663f, 0.870591012f, 0.871571247f, 0.872548357f,
+        0.873522335f, 0.87449317f, 0.875460854f, 0.876425378f,
+        0.877386731f, 0.878344906f, 0.879299893f, 0.880251684f,
+        0.881200268f, 0.882145639f, 0.883087785f, 0.884026699f,
+        0.884962372f, 0.885894795f, 0.886823959f, 0.887749855f,
+        0.888672475f, 0.88959181f, 0.890507851f, 0.891420589f,
+        0.892330017f, 0.893236126f, 0.894138906f, 0.89503835f,
+        0.895934448f, 0.896827194f, 0.897716577f, 0.89860259f,
+        0.899485225f, 0.900364472f, 0.901240325f, 0.902112774f,
+        0.902981811f, 0.903847428f, 0.904709618f, 0.905568371f,
+        0.90642368f, 0.907275537f, 0.908123933f, 0.908968861f,
+        0.909810313f, 0.910648281f, 0.911482757f, 0.912313732f,
+        0.9131412f, 0.913965152f, 0.914785581f, 0.915602479f,
+        0.916415838f, 0.917225651f, 0.918031909f, 0.918834606f,
+        0.919633734f, 0.920429285f, 0.921221251f, 0.922009626f,
+        0.922794402f, 0.923575572f, 0.924353127f, 0.925127061f,
+        0.925897367f, 0.926664037f, 0.927427064f, 0.928186441f,
+        0.92894216f, 0.929694215f, 0.930442599f, 0.931187304f,
+        0.931928323f, 0.93266565f, 0.933399277f, 0.934129198f,
+        0.934855405f, 0.935577892f, 0.936296653f, 0.937011679f,
+        0.937722965f, 0.938430504f, 0.939134289f, 0.939834314f,
+        0.940530571f, 0.941223055f, 0.941911759f, 0.942596676f,
+        0.9432778f, 0.943955124f, 0.944628643f, 0.945298349f,
+        0.945964237f, 0.9466263f, 0.947284532f, 0.947938926f,
+        0.948589478f, 0.949236179f, 0.949879025f, 0.95051801f,
+        0.951153126f, 0.951784369f, 0.952411732f, 0.95303521f,
+        0.953654796f, 0.954270485f, 0.954882271f, 0.955490148f,
+        0.95609411f, 0.956694152f, 0.957290268f, 0.957882453f,
+        0.9584707f, 0.959055005f, 0.959635362f, 0.960211765f,
+        0.960784209f, 0.961352689f, 0.961917199f, 0.962477733f,
+        0.963034288f, 0.963586856f, 0.964135434f, 0.964680016f,
+        0.965220596f, 0.965757171f, 0.966289734f, 0.96681828f,
+        0.967342806f, 0.967863305f, 0.968379773f, 0.968892205f,
+        0.969400596f, 0.969904942f, 0.970405237f, 0.970901477f,
+        0.971393657f, 0.971881773f, 0.97236582f, 0.972845793f,
+        0.973321688f, 0.973793501f, 0.974261226f, 0.97472486f,
+        0.975184399f, 0.975639837f, 0.976091171f, 0.976538396f,
+        0.976981508f, 0.977420504f, 0.977855378f, 0.978286126f,
+        0.978712746f, 0.979135232f, 0.97955358f, 0.979967788f,
+        0.98037785f, 0.980783763f, 0.981185523f, 0.981583127f,
+        0.98197657f, 0.982365849f, 0.982750961f, 0.9831319f,
+        0.983508665f, 0.983881252f, 0.984249656f, 0.984613875f,
+        0.984973904f, 0.985329742f, 0.985681383f, 0.986028826f,
+        0.986372067f, 0.986711101f, 0.987045928f, 0.987376542f,
+        0.987702941f, 0.988025122f, 0.988343082f, 0.988656818f,
+        0.988966327f, 0.989271606f, 0.989572652f, 0.989869463f,
+        0.990162035f, 0.990450365f, 0.990734452f, 0.991014292f,
+        0.991289883f, 0.991561222f, 0.991828306f, 0.992091134f,
+        0.992349702f, 0.992604009f, 0.992854051f, 0.993099826f,
+        0.993341333f, 0.993578568f, 0.99381153f, 0.994040217f,
+        0.994264625f, 0.994484754f, 0.994700601f, 0.994912163f,
+        0.99511944f, 0.995322429f, 0.995521128f, 0.995715535f,
+        0.995905649f, 0.996091467f, 0.996272988f, 0.996450211f,
+        0.996623133f, 0.996791752f, 0.996956069f, 0.997116079f,
+        0.997271783f, 0.997423179f, 0.997570266f, 0.997713041f,
+        0.997851504f, 0.997985653f, 0.998115487f, 0.998241005f,
+        0.998362206f, 0.998479088f, 0.99859165f, 0.998699892f,
+        0.998803812f, 0.99890341f, 0.998998684f, 0.999089633f,
+        0.999176258f, 0.999258556f, 0.999336527f, 0.99941017f,
+        0.999479485f, 0.999544471f, 0.999605127f, 0.999661453f,
+        0.999713449f, 0.999761113f, 0.999804445f, 0.999843446f,
+        0.999878114f, 0.999908449f, 0.999934451f, 0.99995612f,
+        0.999973455f, 0.999986457f, 0.999995124f, 0.999999458f,
+    },
+};
+
+const int16_t FFT_WindowTableQ15[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2] =
+{
+    /* Hamming */
+    {
+        2621, 2621, 2622, 2622, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2630, 2632, 2633, 2635, 2637,
+        2640, 2642, 2644, 2647, 2650, 2653, 2656, 2659, 2662, 2666, 2669, 2673, 2677, 2681, 2685, 2690,
+        2694, 2699, 2703, 2708, 2713, 2718, 2724, 2729, 2735, 2741, 2746, 2752, 2759, 2765, 2771, 2778,
+        2785, 2792, 2799, 2806, 2813, 2820, 2828, 2836, 2843, 2851, 2860, 2868, 2876, 2885, 2893, 2902,
+        2911, 2920, 2930, 2939, 2948, 2958, 2968, 2978, 2988, 2998, 3009, 3019, 3030, 3040, 3051, 3062,
+        3074, 3085, 3096, 3108, 3120, 3131, 3143, 3156, 3168, 3180, 3193, 3206, 3218, 3231, 3244, 3258,
+        3271, 3285, 3298, 3312, 3326, 3340, 3354, 3368, 3383, 3397, 3412, 3427, 3442, 3457, 3472, 3488,
+        3503, 3519, 3535, 3551, 3567, 3583, 3599, 3616, 3632, 3649, 3666, 3683, 3700, 3717, 3735, 3752,
+        3770, 3788, 3806, 3824, 3842, 3860, 3878, 3897, 3916, 3935, 3953, 3973, 3992, 4011, 4031, 4050,
+        4070, 4090, 4110, 4130, 4150, 4170, 4191, 4212, 4232, 4253, 4274, 4295, 4317, 4338, 4359, 4381,
+        4403, 4425, 4447, 4469, 4491, 4514, 4536, 4559, 4581, 4604, 4627, 4650, 4674, 4697, 4720, 4744,
+        4768, 4792, 4816, 4840, 4864, 4888, 4913, 4937, 4962, 4987, 5012, 5037, 5062, 5087, 5113, 5138,
+        5164, 5190, 5216, 5242, 5268, 5294, 5320, 5347, 5373, 5400, 5427, 5454, 5481, 5508, 5535, 5563,
+        5590, 5618, 5646, 5674, 5702, 5730, 5758, 5786, 5815, 5843, 5872, 5901, 5929, 5958, 5987, 6017,
+        6046, 6075, 6105, 6135, 6164, 6194, 6224, 6254, 6284, 6315, 6345, 6376, 6406, 6437, 6468, 6499,
+        6530, 6561, 6592, 6623, 6655, 6686, 6718, 6750, 6782, 6814, 6846, 6878, 6910, 6942, 6975, 7007,
+        7040, 7073, 7106, 7139, 7172, 7205, 7238, 7272, 7305, 7339, 7372, 7406, 7440, 7474, 7508, 7542,
+        7576, 7611, 7645, 7680, 7714, 7749, 7784, 7819, 7854, 7889, 7924, 7959, 7995, 8030, 8066, 8101,
+        8137, 8173, 8209, 8245, 8281, 8317, 8353, 8390, 8426, 8463, 8499, 8536, 8573, 8610, 8647, 8684,
+        8721, 8758, 8795, 8833, 8870, 8908, 8945, 8983, 9021, 9059, 9097, 9135, 9173, 9211, 9249, 9288,
+        9326, 9365, 9403, 9442, 9481, 9520, 9558, 9597, 9637, 9676, 9715, 9754, 9794, 9833, 9872, 9912,
+        9952, 9991, 10031, 10071, 10111, 10151, 10191, 10231, 10272, 10312, 10352, 10393, 10433, 10474, 10514, 10555,
+        10596, 10637, 10678, 10719, 10760, 10801, 10842, 10883, 10925, 10966, 11007, 11049, 11090, 11132, 11174, 11215,
+        11257, 11299, 11341, 11383, 11425, 11467, 11509, 11552, 11594, 11636, 11679, 11721, 11763, 11806, 11849, 11891,
+        11934, 11977, 12020, 12063, 12106, 12149, 12192, 12235, 12278, 12321, 12364, 12408, 12451, 12494, 12538, 12581,
+        12625, 12668, 12712, 12756, 12799, 12843, 12887, 12931, 12975, 13019, 13063, 13107, 13151, 13195, 13239, 13284,
+        13328, 13372, 13416, 13461, 13505, 13550, 13594, 13639, 13683, 13728, 13773, 13817, 13862, 13907, 13952, 13996,
+        14041, 14086, 14131, 14176, 14221, 14266, 14311, 14356, 14401, 14447, 14492, 14537, 14582, 14628, 14673, 14718,
+        14764, 14809, 14854, 14900, 14945, 14991, 15036, 15082, 15127, 15173, 15219, 15264, 15310, 15356, 15401, 15447,
+        15493, 15539, 15584, 15630, 15676, 15722, 15768, 15814, 15860, 15906, 15952, 15998, 16044, 16090, 16136, 16182,
+        16228, 16274, 16320, 16366, 16412, 16458, 16504, 16550, 16596, 16642, 16689, 16735, 16781, 16827, 16873, 16920,
+        16966, 17012, 17058, 17104, 17151, 17197, 17243, 17289, 17336, 17382, 17428, 17474, 17521, 17567, 17613, 17659,
+        17706, 17752, 17798, 17845, 17891, 17937, 17983, 18030, 18076, 18122, 18168, 18215, 18261, 18307, 18353, 18399,
+        18446, 18492, 18538, 18584, 18630, 18677, 18723, 18769, 18815, 18861, 18907, 18953, 19000, 19046, 19092, 19138,
+        19184, 19230, 19276, 19322, 19368, 19414, 19460, 19506, 19552, 19598, 19643, 19689, 19735, 19781, 19827, 19873,
+        19918, 19964, 20010, 20056, 20101, 20147, 20192, 20238, 20284, 20329, 20375, 20420, 20466, 20511, 20557, 20602,
+        20648, 20693, 20738, 20783, 20829, 20874, 20919, 20964, 21010, 21055, 21100, 21145, 21190, 21235, 21280, 21325,
+        21370, 21414, 21459, 21504, 21549, 21593, 21638, 21683, 21727, 21772, 21816, 21861, 21905, 21950, 21994, 22038,
+        22083, 22127, 22171, 22215, 22259, 22304, 22348, 22392, 22435, 22479, 22523, 22567, 22611, 22654, 22698, 22742,
+        22785, 22829, 22872, 22916, 22959, 23002, 23046, 23089, 23132, 23175, 23218, 23261, 23304, 23347, 23390, 23433,
+        23476, 23518, 23561, 23604, 23646, 23689, 23731, 23773, 23816, 23858, 23900, 23942, 23984, 24026, 24068, 24110,
+        24152, 24194, 24236, 24277, 24319, 24360, 24402, 24443, 24484, 24526, 24567, 24608, 24649, 24690, 24731, 24772,
+        24813, 24854, 24894, 24935, 24975, 25016, 25056, 25097, 25137, 25177, 25217, 25257, 25297, 25337, 25377, 25417,
+        25456, 25496, 25536, 25575, 25615, 25654, 25693, 25732, 25771, 25810, 25849, 25888, 25927, 25966, 26004, 26043,
+        26081, 26120, 26158, 26196, 26235, 26273, 26311, 26349, 26386, 26424, 26462, 26499, 26537, 26574, 26612, 26649,
+        26686, 26723, 26760, 26797, 26834, 26871, 26907, 26944, 26980, 27017, 27053, 27089, 27125, 27162, 27197, 27233,
+        27269, 27305, 27340, 27376, 27411, 27447, 27482, 27517, 27552, 27587, 27622, 27657, 27691, 27726, 27760, 27795,
+        27829, 27863, 27897, 27931, 27965, 27999, 28033, 28066, 28100, 28133, 28167, 28200, 28233, 28266, 28299, 28332,
+        28365, 28397, 28430, 28462, 28494, 28527, 28559, 28591, 28623, 28655, 28686, 28718, 28749, 28781, 28812, 28843,
+        28874, 28905, 28936, 28967, 28998, 29028, 29059, 29089, 29119, 29149, 29179, 29209, 29239, 29269, 29298, 29328,
+        29357, 29386, 29415, 29445, 29473, 29502, 29531, 29560, 29588, 29616, 29645, 29673, 29701, 29729, 29756, 29784,
+        29812, 29839, 29867, 29894, 29921, 29948, 29975, 30002, 30028, 30055, 30081, 30107, 30134, 30160, 30186, 30211,
+        30237, 30263, 30288, 30314, 30339, 30364, 30389, 30414, 30439, 30463, 30488, 30512, 30536, 30561, 30585, 30609,
+        30632, 30656, 30680, 30703, 30726, 30750, 30773, 30796, 30818, 30841, 30864, 30886, 30908, 30931, 30953, 30975,
+        30996, 31018, 31040, 31061, 31082, 31104, 31125, 31146, 31166, 31187, 31208, 31228, 31248, 31269, 31289, 31309,
+        31328, 31348, 31368, 31387, 31406, 31425, 31444, 31463, 31482, 31501, 31519, 31538, 31556, 31574, 31592, 31610,
+        31627, 31645, 31662, 31680, 31697, 31714, 31731, 31748, 31764, 31781, 31797, 31814, 31830, 31846, 31862, 31877,
+        31893, 31908, 31924, 31939, 31954, 31969, 31984, 31998, 32013, 32027, 32041, 32056, 32069, 32083, 32097, 32111,
+        32124, 32137, 32151, 32164, 32176, 32189, 32202, 32214, 32227, 32239, 32251, 32263, 32275, 32286, 32298, 32309,
+        32320, 32332, 32343, 32353, 32364, 32375, 32385, 32395, 32405, 32415, 32425, 32435, 32445, 32454, 32463, 32473,
+        32482, 32490, 32499, 32508, 32516, 32525, 32533, 32541, 32549, 32557, 32564, 32572, 32579, 32586, 32593, 32600,
+        32607, 32614, 32620, 32627, 32633, 32639, 32645, 32651, 32656, 32662, 32667, 32673, 32678, 32683, 32687, 32692,
+        32697, 32701, 32705, 32709, 32713, 32717, 32721, 32724, 32728, 32731, 32734, 32737, 32740, 32743, 32745, 32748,
+        32750, 32752, 32754, 32756, 32758, 32759, 32761, 32762, 32763, 32764, 32765, 32766, 32766, 32767, 32767, 32767,
+    },
+};
+
+const uint8_t FFT_WindowRow[FFT_WINDOW_COUNT] =
+{
+    1U, 0U, 1U, 1U, 1U
+};
+
+const FFT_WindowGain_T FFT_WindowGains[FFT_WINDOW_COUNT] =
+{
+    { 0.499755859f, 0.374816895f, 1.50073278f }, /* Hann */
+    { 0.539775391f, 0.397209082f, 1.36330494f }, /* Hamming */
+    { 0.358574858f, 0.257837396f, 2.00533178f }, /* 4 term Blackman-Harris */
+    { 0.215473481f, 0.175133947f, 3.77209549f }, /* Flat top */
+    { 0.411445491f, 0.297677535f, 1.75841527f }, /* Kaiser, beta 9 */
+};
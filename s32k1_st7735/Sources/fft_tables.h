@@ -0,0 +1,62 @@
+/* Generated by tools/fft_tables.py -n 2048 --windows hamming, do not edit */
+
+#ifndef FFT_TABLES_H
+#define FFT_TABLES_H
+
+#include <stdint.h>
+
+#define FFT_TABLE_SIZE                                  (2048U)
+#define FFT_TABLE_POWER_OF_TWO                          (11U)
+#define FFT_BIT_REVERSE_SWAPS                           (992U)
+#define FFT_BIT_REVERSE_HALF_SWAPS                      (496U)
+
+#define FFT_WINDOW_HANN                                 (0U)
+#define FFT_WINDOW_HAMMING                              (1U)
+#define FFT_WINDOW_BLACKMAN_HARRIS                      (2U)
+#define FFT_WINDOW_FLAT_TOP                             (3U)
+#define FFT_WINDOW_KAISER                               (4U)
+#define FFT_WINDOW_COUNT                                (5U)
+
+/* Windows in FFT_WindowTable, bit FFT_WINDOW_* set for each one */
+#define FFT_WINDOWS                                     (0x02U)
+#define FFT_WINDOW_ROWS                                 (1U)
+
+typedef struct FFT_Complex_Tag
+{
+    float re;
+    float im;
+} FFT_Complex_T;
+
+typedef struct FFT_WindowGain_Tag
+{
+    float coherent;     /* Mean of the window, the amplitude of a tone at a bin centre is scaled by this */
+    float power;        /* Mean of the squared window, the power of a tone or noise is scaled by this */
+    float enbw;         /* Equivalent noise bandwidth in bins, power / coherent^2 */
+} FFT_WindowGain_T;
+
+/* e^(-2*pi*i*k/FFT_TABLE_SIZE) for k = 0 .. FFT_TABLE_SIZE/2 - 1 */
+extern const FFT_Complex_T FFT_TwiddleTable[FFT_TABLE_SIZE / 2];
+
+/* The same in Q15, real part in bits 0-15 and imaginary part in bits 16-31 */
+extern const uint32_t FFT_TwiddleTableQ15[FFT_TABLE_SIZE / 2];
+
+/* Index pairs i < j to swap for the bit reversal of FFT_TABLE_SIZE points */
+extern const uint16_t FFT_BitReverseTable[FFT_BIT_REVERSE_SWAPS][2];
+
+/* The same for FFT_TABLE_SIZE / 2 points */
+extern const uint16_t FFT_BitReverseTableHalf[FFT_BIT_REVERSE_HALF_SWAPS][2];
+
+/* Coefficients 0 .. FFT_TABLE_SIZE/2 - 1 of each window in FFT_WINDOWS,
+ * coefficient FFT_TABLE_SIZE - 1 - k equals coefficient k */
+extern const float FFT_WindowTable[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2];
+
+/* The same in Q15 */
+extern const int16_t FFT_WindowTableQ15[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2];
+
+/* Row of each FFT_WINDOW_* in the window tables, FFT_WINDOW_ROWS if not generated */
+extern const uint8_t FFT_WindowRow[FFT_WINDOW_COUNT];
+
+/* Gains of each window over all FFT_TABLE_SIZE coefficients */
+extern const FFT_WindowGain_T FFT_WindowGains[FFT_WINDOW_COUNT];
+
+#endif /* FFT_TABLES_H */
@@ -122,10 +122,13 @@ void GetFFTPlot(void)
 
         PINS_DRV_SetPins(PTD, 1 << 0);
 
+        /* Get FFT_FREQ_BANDS bands showing the accumulated elements per frequency,
+         * a frame that was overwritten while it was copied is not plotted */
+        if (FFT_GetFrequencyResponse(&parsedFreqResponseBands[0]))
         {
             {
-                /* Get FFT_FREQ_BANDS bands showing the accumulated elements per frequency */
-                FFT_GetFrequencyResponse(&parsedFreqResponseBands[0]);
+                /* Smooth the bands over time and update their peak hold */
+                FFT_SmoothFrequencyResponse(&parsedFreqResponseBands[0]);
             }
 
             {
@@ -43,6 +43,9 @@
 // Initialization commands for ST7735 screens
 #define DELAY (0x80)
 
+// Characters that drawString() keeps from its measuring pass
+#define TFT_ST7735_LAYOUT_CHARS (32)
+
 /**
  * Read a byte from ROM (const unsigned char)
  * @attention Original from AVR-GCC http://download.savannah.gnu.org/releases/avr-libc/
@@ -51,9 +54,61 @@
  */
 #define TFT_ST7735_PGM_READ_BYTE(addr) (*((const uint8_t*)(addr)))
 
+#ifdef TFT_ST7735_FIXED_ROTATION
+
+// Panel and rotation are fixed at build time, so the geometry is made of constants
+#if (TFT_ST7735_FIXED_ROTATION < 0) || (TFT_ST7735_FIXED_ROTATION > 3)
+  #error "TFT_ST7735_FIXED_ROTATION must be 0 to 3"
+#endif
+
+#define tabcolor (TAB_COLOUR)
+#define rotation (TFT_ST7735_FIXED_ROTATION)
+
+#if (TFT_ST7735_FIXED_ROTATION & 1)
+  #define _width  (ST7735_TFTHEIGHT)
+  #define _height (ST7735_TFTWIDTH)
+#else
+  #define _width  (ST7735_TFTWIDTH)
+  #define _height (ST7735_TFTHEIGHT)
+#endif
+
+#if (TAB_COLOUR == INITR_GREENTAB2) && (TFT_ST7735_FIXED_ROTATION & 1)
+  #define colstart (1)
+  #define rowstart (2)
+#elif (TAB_COLOUR == INITR_GREENTAB) || (TAB_COLOUR == INITR_GREENTAB2)
+  #define colstart (2)
+  #define rowstart (1)
+#else
+  #define colstart (0)
+  #define rowstart (0)
+#endif
+
+#if (TAB_COLOUR == INITR_BLACKTAB) || (TAB_COLOUR == INITR_GREENTAB2)
+  #define MADCTL_ORDER (MADCTL_RGB)
+#else
+  #define MADCTL_ORDER (MADCTL_BGR)
+#endif
+
+#if (TFT_ST7735_FIXED_ROTATION == 0)
+  #define madctl (MADCTL_MX | MADCTL_MY | MADCTL_ORDER)
+#elif (TFT_ST7735_FIXED_ROTATION == 1)
+  #define madctl (MADCTL_MY | MADCTL_MV | MADCTL_ORDER)
+#elif (TFT_ST7735_FIXED_ROTATION == 2)
+  #define madctl (MADCTL_ORDER)
+#else
+  #define madctl (MADCTL_MX | MADCTL_MV | MADCTL_ORDER)
+#endif
+
+#else
+
 static uint8_t tabcolor, colstart, rowstart; // some displays need this changed
-static int16_t  _width, _height, // Display w/h as modified by current rotation
-         cursor_x, cursor_y, padX;
+static uint8_t madctl; // Memory access control value in use for the current rotation
+static int16_t  _width, _height; // Display w/h as modified by current rotation
+static uint8_t  rotation;
+
+#endif // TFT_ST7735_FIXED_ROTATION
+
+static int16_t  cursor_x, cursor_y, padX;
 
 static uint16_t textcolor, textbgcolor, fontsloaded;
 
@@ -61,11 +116,85 @@ static uint8_t  addr_row, addr_col;
 
 static uint8_t  textfont,
          textsize,
-         textdatum,
-         rotation;
+         textdatum;
 
 static uint8_t textwrap; // If set, 'wrap' text at right edge of display
 
+static const fontindexed *loadedfont; // Font drawn as TFT_LOADED_FONT
+
+// A character of a text box line, decoded one font row at a time
+typedef struct {
+  const uint8_t *data; // Next byte of the character image
+  int16_t  x;          // Left of the character cell in the line, in font pixels
+  uint8_t  width;      // Pixels in a row of the image
+  uint8_t  run;        // RLE fonts: pixels left in the current run
+  uint8_t  level;      // RLE fonts: level of the current run
+  int8_t   dx, top;    // Indexed fonts: bounding box position in the cell
+  uint8_t  rows;       // Indexed fonts: bounding box height
+} textglyph;
+
+// Font 7 style digit: segment boxes in a 32 x 48 cell, the ends of every
+// segment are bevelled over half its thickness (see fillSegment)
+#define SEVENSEG_CELL_W  (32)
+#define SEVENSEG_CELL_H  (48)
+#define SEVENSEG_POINT_W (12)
+
+static const uint8_t sevenseg_box[7][4] = {
+  //x0, y0, x1, y1
+  {  6,  1, 24,  5 }, // A
+  { 23,  5, 28, 21 }, // B
+  { 23, 26, 28, 42 }, // C
+  {  6, 42, 24, 46 }, // D
+  {  2, 26,  7, 42 }, // E
+  {  2,  5,  7, 21 }, // F
+  {  4, 21, 26, 25 }, // G
+};
+
+// Lit segments of the digits 0 to 9, bit 0 = A ... bit 6 = G
+static const uint8_t sevenseg_digit[10] = {
+  0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+// RGB565 colours for each level of an indexed font pixel, high byte first
+static uint8_t  ramp[16][2];
+static uint16_t ramp_fg, ramp_bg;
+static uint8_t  ramp_bpp; // 0 when the ramp has to be computed
+
+#ifdef TFT_ST7735_METRICS_CACHE_ENTRIES
+// Width of a string drawn before, keyed by its address and font
+typedef struct {
+  const char *string;
+  uint16_t    width; // Pixel width at text size 1
+  uint8_t     font;
+} metricsentry;
+
+static metricsentry metrics_entry[TFT_ST7735_METRICS_CACHE_ENTRIES];
+static uint8_t      metrics_next; // Entry that is replaced next
+#endif
+
+// Ping-pong line buffers, one is filled while the other is sent by the SPI
+static uint8_t  linebuf[2][TFT_ST7735_LINE_BUFFER_PIXELS * 2];
+static uint8_t  linebuf_sel;
+
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+// A character expanded to RGB565 in the glyph arena
+typedef struct {
+  uint16_t uniCode;
+  uint16_t fg, bg;
+  uint8_t  font, size;
+  uint16_t w, h;      // Pixel size of the image
+  uint16_t advance;   // Value returned by drawChar_uniCode()
+  uint16_t offset;    // Position in glyph_arena
+  uint32_t used;      // Time stamp of the last draw, for LRU replacement
+} glyphentry;
+
+static uint8_t    glyph_arena[TFT_ST7735_GLYPH_CACHE_BYTES];
+static glyphentry glyph_entry[TFT_ST7735_GLYPH_CACHE_ENTRIES]; // Kept in arena order
+static uint8_t    glyph_count;
+static uint16_t   glyph_arena_used;
+static uint32_t   glyph_clock, glyph_hits, glyph_misses;
+#endif
+
 static const uint8_t Bcmd[] = {                  // Initialization commands for 7735B screens
         18,                       // 18 commands in list:
         ST7735_SWRESET,   DELAY,  //  1: Software reset, no args, w/delay
@@ -232,6 +361,143 @@ static void TFT_ST7735_Construct(int16_t w, int16_t h);
  */
 static void tftswap(int16_t *a, int16_t *b);
 
+/**
+ * Get the line buffer that is not in use by the SPI transfer in progress
+ * @return pointer to TFT_ST7735_LINE_BUFFER_PIXELS * 2 bytes
+ */
+static uint8_t* TFT_ST7735_getLineBuffer(void);
+
+/**
+ * Send the same colour len times with block transfers
+ * @attention setWindow() must have been called, CS stays low
+ * @param color - RGB565 colour
+ * @param len - number of pixels
+ */
+static void TFT_ST7735_writeColor(uint16_t color, uint32_t len);
+
+/**
+ * Send a 1 bit image (rows MSB first) scaled by size through a single window
+ * @attention Scaled pixels that are not fully on screen are clipped
+ * @param byteWidth - bytes per image row
+ * @param w, h - image size in image pixels
+ * @param size - every image pixel is drawn as a size x size block
+ */
+static void TFT_ST7735_writeBitmapBlock(int16_t x, int16_t y, const uint8_t *bitmap, int16_t byteWidth,
+                                        int16_t w, int16_t h, uint8_t size, uint16_t color, uint16_t bg);
+
+/**
+ * Send the horizontal runs of set bits of a 1 bit image scaled by size,
+ * one window and one block per run (transparent background)
+ * @attention Scaled pixels that are not fully on screen are clipped
+ */
+static void TFT_ST7735_writeBitmapRuns(int16_t x, int16_t y, const uint8_t *bitmap, int16_t byteWidth,
+                                       int16_t w, int16_t h, uint8_t size, uint16_t color);
+
+/**
+ * Read the next character of a UTF-8 string
+ * @attention Bytes that do not start a valid sequence are returned as they are (Latin-1)
+ * @param string - advanced past the character
+ * @return the character code
+ */
+static unsigned int TFT_ST7735_decodeUTF8(char **string);
+
+/**
+ * Width of a character at text size 1
+ * @return 0 if the font has no such character
+ */
+static uint16_t TFT_ST7735_charWidth(unsigned int uniCode, int font);
+
+/**
+ * Draw a string with the current datum and padding
+ * @param cached - the width may be taken from, and is stored in, the metrics cache
+ * @return the pixel width drawn
+ */
+static int TFT_ST7735_drawStringLayout(char *string, int poX, int poY, int font, uint8_t cached);
+
+/**
+ * Width of a character as drawn with a background, at text size 1
+ * @attention Font 2 characters are drawn in whole bytes
+ */
+static uint16_t TFT_ST7735_drawnWidth(unsigned int uniCode, int font);
+
+/**
+ * Format a value scaled by 10^decimals right justified into chars characters,
+ * using integer arithmetic only. Values that do not fit are clamped to the
+ * largest magnitude that fits with their sign, e.g. "-.99" or "-9".
+ * @param str - destination, chars + 1 bytes
+ * @attention decimals must be 0 or at most chars - 2
+ */
+static void TFT_ST7735_formatFixed(char *str, int32_t value, uint8_t chars, uint8_t decimals);
+
+/**
+ * Fill one segment of a seven segment digit
+ * @param x, y - top left of the digit cell
+ * @param seg - 0 (A) to 6 (G)
+ */
+static void TFT_ST7735_fillSegment(int16_t x, int16_t y, uint8_t size, uint8_t seg, uint16_t color);
+
+/**
+ * Find where the next text box line ends
+ * @param text - start of the line, advanced to the start of the next line
+ * @param maxWidth - line width in font pixels
+ * @param end - set to the end of the characters on this line
+ * @return the width of the line in font pixels
+ */
+static int16_t TFT_ST7735_wrapLine(char **text, int16_t maxWidth, int font, char **end);
+
+/**
+ * Set up the row decoder of a text box character
+ * @return the character advance in font pixels
+ */
+static int16_t TFT_ST7735_startTextGlyph(textglyph *tg, unsigned int uniCode, int fontnum, int16_t x);
+
+/**
+ * Decode the next font row of a text box character into pixel levels
+ */
+static void TFT_ST7735_textGlyphRow(textglyph *tg, uint8_t row, int font, uint8_t *level, int16_t maxWidth);
+
+/**
+ * Find the glyph of a character in an indexed font
+ * @return 0 if the font has no such character
+ */
+static const fontglyph* TFT_ST7735_findGlyph(const fontindexed *f, unsigned int uniCode);
+
+/**
+ * Draw a character of the loaded indexed font
+ * @return the x advance, 0 if the character is not in the font
+ */
+static int TFT_ST7735_drawIndexedChar(unsigned int uniCode, int x, int y);
+
+/**
+ * Decode one RLE row of an indexed glyph into one level per pixel
+ * @param level - destination covering cw pixels, 0 to only skip the row
+ * @param px - position of the first glyph pixel in the destination
+ * @return pointer to the next row
+ */
+static const uint8_t* TFT_ST7735_decodeIndexedRow(const uint8_t *data, uint8_t w, uint8_t bpp,
+                                                  uint8_t *level, int16_t px, int16_t cw);
+
+/**
+ * Update the colour ramp from the text background to the text colour
+ * @param bpp - bits per pixel of the font, the ramp has 2^bpp entries
+ */
+static void TFT_ST7735_setRamp(uint8_t bpp);
+
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+/**
+ * Draw a character from the glyph cache, adding it first if needed
+ * @return the x advance, or -1 if the character can not be cached or does
+ * not fit on screen and must be drawn by the normal renderer
+ */
+static int TFT_ST7735_drawCachedGlyph(unsigned int uniCode, int x, int y, int font);
+
+/**
+ * Expand a character in the current text colours and size into RGB565
+ * @param img - destination, w * h pixels
+ */
+static void TFT_ST7735_renderGlyph(uint8_t *img, unsigned int uniCode, int fontnum, uint16_t w, uint16_t h);
+#endif
+
 static char* TFT_ST7735_ltoa(long N, char *str, int base)
 {
       int i = 2;
@@ -276,6 +542,33 @@ static void tftswap(int16_t *a, int16_t *b)
     *b = temp;
 }
 
+static uint8_t* TFT_ST7735_getLineBuffer(void)
+{
+    linebuf_sel ^= 1;
+
+    return &linebuf[linebuf_sel][0];
+}
+
+static void TFT_ST7735_writeColor(uint16_t color, uint32_t len)
+{
+    uint8_t *buf = TFT_ST7735_getLineBuffer();
+    uint32_t n = (len < TFT_ST7735_LINE_BUFFER_PIXELS) ? len : TFT_ST7735_LINE_BUFFER_PIXELS;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        buf[2 * i]     = color >> 8;
+        buf[2 * i + 1] = color;
+    }
+
+    // The buffer content does not change, so it can be sent again straight away
+    while (len)
+    {
+        n = (len < TFT_ST7735_LINE_BUFFER_PIXELS) ? len : TFT_ST7735_LINE_BUFFER_PIXELS;
+        TFT_ST7735_Write_SPI(buf, n * 2);
+        len -= n;
+    }
+}
+
 /***************************************************************************************
 ** Function name:           TFT_ST7735
 ** Description:             Constructor
@@ -289,9 +582,14 @@ static void TFT_ST7735_Construct(int16_t w, int16_t h)
 
     (void)TFT_ST7735_Set_Chip_Select(CHIP_SELECT_HIGH);
 
+#ifndef TFT_ST7735_FIXED_ROTATION
     _width    = w;
     _height   = h;
     rotation  = 0;
+#else
+    (void)w;
+    (void)h;
+#endif
     cursor_y  = cursor_x    = 0;
     textfont  = 1;
     textsize  = 1;
@@ -359,6 +657,7 @@ void TFT_ST7735_writedata(uint8_t c)
 ** Description:             Raise the Chip Select
 ***************************************************************************************/
 void TFT_ST7735_writeEnd() {
+  TFT_ST7735_Wait_SPI(); // A block transfer may still be in progress
   (void)TFT_ST7735_Set_Chip_Select(CHIP_SELECT_HIGH);
 }
 
@@ -389,8 +688,11 @@ void TFT_ST7735_init(void)
     (void)TFT_ST7735_Set_Reset(RESET_PIN_HIGH);
     TFT_ST7735_Delay(TFT_ST7735_THIRD_RESET_HIGH_DELAY);
 
+#ifndef TFT_ST7735_FIXED_ROTATION
     tabcolor = TAB_COLOUR;
+#endif
 
+    // With a fixed rotation tabcolor is a constant and the unused tables are dropped
     if (tabcolor == INITB)
     {
         TFT_ST7735_commandList(&Bcmd[0]);
@@ -401,16 +703,12 @@ void TFT_ST7735_init(void)
         if (tabcolor == INITR_GREENTAB)
         {
             TFT_ST7735_commandList(&Rcmd2green[0]);
-            colstart = 2;
-            rowstart = 1;
         }
         else if (tabcolor == INITR_GREENTAB2)
         {
             TFT_ST7735_commandList(&Rcmd2green[0]);
             TFT_ST7735_writecommand(ST7735_MADCTL);
             TFT_ST7735_writedata(0xC0);
-            colstart = 2;
-            rowstart = 1;
         }
         else if (tabcolor == INITR_REDTAB)
         {
@@ -423,6 +721,30 @@ void TFT_ST7735_init(void)
         }
         TFT_ST7735_commandList(&Rcmd3[0]);
     }
+
+#ifdef TFT_ST7735_FIXED_ROTATION
+    TFT_ST7735_setRotation(TFT_ST7735_FIXED_ROTATION);
+#else
+    // Offsets and memory access control as left by the tables (rotation 0)
+    if ((tabcolor == INITR_GREENTAB) || (tabcolor == INITR_GREENTAB2))
+    {
+        colstart = 2;
+        rowstart = 1;
+    }
+
+    if (tabcolor == INITB)
+    {
+        madctl = 0x08;
+    }
+    else if ((tabcolor == INITR_GREENTAB2) || (tabcolor == INITR_BLACKTAB))
+    {
+        madctl = 0xC0;
+    }
+    else
+    {
+        madctl = 0xC8;
+    }
+#endif
 }
 
 /***************************************************************************************
@@ -812,16 +1134,175 @@ void TFT_ST7735_fillTriangle ( int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 ***************************************************************************************/
 void TFT_ST7735_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
 {
+  // Each horizontal run of set bits is sent as one window and one block of pixels
+  TFT_ST7735_writeBitmapRuns(x, y, bitmap, (w + 7) / 8, w, h, 1, color);
+}
+
+/***************************************************************************************
+** Function name:           drawBitmap_bgcolor
+** Description:             Draw a 1 bit image with a background colour as a single block
+***************************************************************************************/
+void TFT_ST7735_drawBitmap_bgcolor(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+  TFT_ST7735_writeBitmapBlock(x, y, bitmap, (w + 7) / 8, w, h, 1, color, bg);
+}
+
+/***************************************************************************************
+** Function name:           writeBitmapBlock
+** Description:             Send a scaled 1 bit image through one window
+***************************************************************************************/
+static void TFT_ST7735_writeBitmapBlock(int16_t x, int16_t y, const uint8_t *bitmap, int16_t byteWidth,
+                                        int16_t w, int16_t h, uint8_t size, uint16_t color, uint16_t bg)
+{
+  int16_t i, j;
+  uint8_t rep, dup;
+
+  // Clip to the screen, the window only covers the visible part of the image
+  int16_t left   = (x < 0) ? (size - 1 - x) / size : 0;
+  int16_t top    = (y < 0) ? (size - 1 - y) / size : 0;
+  int16_t right  = (x + w * size > _width)  ? (_width  - x) / size : w;
+  int16_t bottom = (y + h * size > _height) ? (_height - y) / size : h;
+  if ((left >= right) || (top >= bottom)) return;
+
+  uint8_t th = color >> 8, tl = color;
+  uint8_t bh = bg >> 8,    bl = bg;
+
+  TFT_ST7735_setWindow(x + left * size, y + top * size, x + right * size - 1, y + bottom * size - 1);
+
+  // Bits are expanded into a line buffer that is sent every TFT_ST7735_LINE_BUFFER_PIXELS pixels
+  uint8_t *buf = TFT_ST7735_getLineBuffer();
+  uint16_t n = 0;
+
+  for (j = top; j < bottom; j++) {
+    const uint8_t *row = bitmap + j * byteWidth;
+
+    for (rep = 0; rep < size; rep++) {
+      for (i = left; i < right; i++) {
+        uint8_t set = TFT_ST7735_PGM_READ_BYTE(row + (i >> 3)) & (0x80 >> (i & 7));
+
+        for (dup = 0; dup < size; dup++) {
+          if (set) {
+            buf[n++] = th;
+            buf[n++] = tl;
+          }
+          else {
+            buf[n++] = bh;
+            buf[n++] = bl;
+          }
+
+          if (n == sizeof(linebuf[0])) {
+            TFT_ST7735_Write_SPI(buf, n);
+            buf = TFT_ST7735_getLineBuffer();
+            n = 0;
+          }
+        }
+      }
+    }
+  }
+
+  if (n) TFT_ST7735_Write_SPI(buf, n);
+
+  TFT_ST7735_writeEnd();
+}
+
+/***************************************************************************************
+** Function name:           writeBitmapRuns
+** Description:             Send the runs of set bits of a scaled 1 bit image
+***************************************************************************************/
+static void TFT_ST7735_writeBitmapRuns(int16_t x, int16_t y, const uint8_t *bitmap, int16_t byteWidth,
+                                       int16_t w, int16_t h, uint8_t size, uint16_t color)
+{
+  int16_t i, j, start;
+  uint8_t drawn = 0;
 
-  int16_t i, j, byteWidth = (w + 7) / 8;
+  int16_t left   = (x < 0) ? (size - 1 - x) / size : 0;
+  int16_t top    = (y < 0) ? (size - 1 - y) / size : 0;
+  int16_t right  = (x + w * size > _width)  ? (_width  - x) / size : w;
+  int16_t bottom = (y + h * size > _height) ? (_height - y) / size : h;
 
-  for (j = 0; j < h; j++) {
-    for (i = 0; i < w; i++ ) {
-      if (TFT_ST7735_PGM_READ_BYTE(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-        TFT_ST7735_drawPixel(x + i, y + j, color);
+  for (j = top; j < bottom; j++) {
+    const uint8_t *row = bitmap + j * byteWidth;
+
+    for (i = left; i < right; ) {
+      if (!(TFT_ST7735_PGM_READ_BYTE(row + (i >> 3)) & (0x80 >> (i & 7)))) {
+        i++;
+        continue;
       }
+      start = i;
+      while ((i < right) && (TFT_ST7735_PGM_READ_BYTE(row + (i >> 3)) & (0x80 >> (i & 7)))) i++;
+
+      TFT_ST7735_setWindow(x + start * size, y + j * size, x + i * size - 1, y + (j + 1) * size - 1);
+      TFT_ST7735_writeColor(color, (uint32_t)(i - start) * size * size);
+      drawn = 1;
+    }
+  }
+
+  if (drawn) TFT_ST7735_writeEnd();
+}
+
+/***************************************************************************************
+** Function name:           blitTransformed
+** Description:             Draw a 16 bit image rotated/mirrored by the TFT (MADCTL)
+***************************************************************************************/
+// The image is streamed in its natural order, the memory access control register
+// is temporarily changed so that the display controller does the transform.
+// x, y is the top left corner on screen of the transformed image, which must fit
+// on the screen (nothing is drawn otherwise).
+void TFT_ST7735_blitTransformed(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h, uint8_t transform)
+{
+  uint8_t swap = transform & TFT_TRANSFORM_SWAP_XY;
+  uint8_t flipx = transform & TFT_TRANSFORM_FLIP_X;
+  uint8_t flipy = transform & TFT_TRANSFORM_FLIP_Y;
+  int16_t dw = swap ? h : w; // Size on screen
+  int16_t dh = swap ? w : h;
+  int16_t u0, v0;
+
+  if ((w <= 0) || (h <= 0) || (x < 0) || (y < 0) || (x + dw > _width) || (y + dh > _height)) return;
+
+  // Start of the window in the transformed address space, columns follow image rows
+  if (swap) {
+    u0 = flipy ? _height - y - w : y;
+    v0 = flipx ? _width  - x - h : x;
+  }
+  else {
+    u0 = flipx ? _width  - x - w : x;
+    v0 = flipy ? _height - y - h : y;
+  }
+
+  // Screen x/y flips act on the other panel axis when the rotation exchanges rows/columns
+  uint8_t m = madctl;
+  if (flipx) m ^= (madctl & MADCTL_MV) ? MADCTL_MY : MADCTL_MX;
+  if (flipy) m ^= (madctl & MADCTL_MV) ? MADCTL_MX : MADCTL_MY;
+  if (swap)  m ^= MADCTL_MV;
+
+  TFT_ST7735_writecommand(ST7735_MADCTL);
+  TFT_ST7735_writedata(m);
+
+  // The column/row offsets belong to the panel axes so they are exchanged with MV
+  if (swap) {
+    u0 += rowstart - colstart;
+    v0 += colstart - rowstart;
+  }
+  TFT_ST7735_setWindow(u0, v0, u0 + w - 1, v0 + h - 1);
+
+  uint32_t len = (uint32_t)w * h;
+  while (len) {
+    uint8_t *buf = TFT_ST7735_getLineBuffer();
+    uint16_t n = (len < TFT_ST7735_LINE_BUFFER_PIXELS) ? len : TFT_ST7735_LINE_BUFFER_PIXELS;
+
+    for (uint16_t i = 0; i < n; i++) {
+      uint16_t color = *(image++);
+      buf[2 * i]     = color >> 8;
+      buf[2 * i + 1] = color;
     }
+    TFT_ST7735_Write_SPI(buf, n * 2);
+    len -= n;
   }
+  TFT_ST7735_writeEnd();
+
+  // Back to the orientation of the current rotation
+  TFT_ST7735_writecommand(ST7735_MADCTL);
+  TFT_ST7735_writedata(madctl);
 }
 
 /***************************************************************************************
@@ -947,32 +1428,43 @@ int16_t TFT_ST7735_height(void)
 int16_t TFT_ST7735_textWidth(char *string, int font)
 {
   unsigned int str_width  = 0;
-  char uniCode;
-  char *widthtable;
 
-  if (font <= 1 || font >= 9)
+  if (font < 1 || font > TFT_LOADED_FONT)
   {
       /* Default */
       font = 2;
   }
 
-  widthtable = (char *)(fontdata[font].widthtbl - 32); //subtract the 32 outside the loop
-
   while (*string)
   {
-    uniCode = *(string++);
+    str_width += TFT_ST7735_charWidth(TFT_ST7735_decodeUTF8(&string), font);
+  }
+  return str_width * textsize;
+}
+
+/***************************************************************************************
+** Function name:           charWidth
+** Description:             Return the width in pixels of a character at text size 1
+***************************************************************************************/
+static uint16_t TFT_ST7735_charWidth(unsigned int uniCode, int font)
+{
+  if (font == TFT_LOADED_FONT)
+  {
+      const fontglyph *g = TFT_ST7735_findGlyph(loadedfont, uniCode);
+      return g ? g->advance : 0;
+  }
 #ifdef LOAD_GLCD
-    if (font == 1)
-    {
-        str_width += 6;
-    }
-    else
+  if (font == 1)
+  {
+      return (uniCode < 255) ? 6 : 0;
+  }
 #endif
-    {
-        str_width += TFT_ST7735_PGM_READ_BYTE(widthtable + uniCode); // Normally we need to substract 32 from uniCode
-    }
+  // The width tables only hold 96 characters
+  if ((font < TFT_LOADED_FONT) && fontdata[font].widthtbl && (uniCode >= 32) && (uniCode < 128))
+  {
+      return TFT_ST7735_PGM_READ_BYTE(fontdata[font].widthtbl + uniCode - 32);
   }
-  return str_width * textsize;
+  return 0;
 }
 
 /***************************************************************************************
@@ -993,6 +1485,8 @@ uint16_t TFT_ST7735_fontsLoaded(void)
 ***************************************************************************************/
 int16_t TFT_ST7735_fontHeight(int font)
 {
+  if (font == TFT_LOADED_FONT) return loadedfont ? loadedfont->height * textsize : 0;
+
   return (fontdata[font].height * textsize);
 }
 
@@ -1008,61 +1502,20 @@ void TFT_ST7735_drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
       ((x + 6 * size - 1) < 0) || // Clip left
       ((y + 8 * size - 1) < 0))   // Clip top
     return;
-  uint8_t fillbg = (bg != color);
-
-// This is about 5 times faster for textsize=1 with background (at 200us per character)
-  if ((size==1) && fillbg)
-  {
-    uint8_t column[6];
-    uint8_t mask = 0x1;
-    TFT_ST7735_setWindow(x, y, x+5, y+8);
-    for (int8_t i = 0; i < 5; i++ ) column[i] = TFT_ST7735_PGM_READ_BYTE(font + (c * 5) + i);
-    column[5] = 0;
+  uint8_t rows[8];
 
+  // The font is stored by columns, turn the 5 columns (and 1 blank) into rows MSB first
+  for (int8_t j = 0; j < 8; j++) rows[j] = 0;
+  for (int8_t i = 0; i < 5; i++ ) {
+    uint8_t line = TFT_ST7735_PGM_READ_BYTE(font + (c * 5) + i);
     for (int8_t j = 0; j < 8; j++) {
-      for (int8_t k = 0; k < 5; k++ ) {
-        if (column[k] & mask) {
-          TFT_ST7735_WRITE_BYTE_SPI(color >> 8);
-          TFT_ST7735_WRITE_BYTE_SPI(color);
-        }
-        else {
-          TFT_ST7735_WRITE_BYTE_SPI(bg >> 8);
-          TFT_ST7735_WRITE_BYTE_SPI(bg);
-        }
-      }
-
-      mask <<= 1;
-      TFT_ST7735_WRITE_BYTE_SPI(bg >> 8);
-      TFT_ST7735_WRITE_BYTE_SPI(bg);
-    }
-  }
-  else
-  {
-    if (size == 1) // default size
-    {
-      for (int8_t i = 0; i < 5; i++ ) {
-        uint8_t line = TFT_ST7735_PGM_READ_BYTE(font + c*5 + i);
-        if (line & 0x1)  TFT_ST7735_drawPixel(x + i, y, color);
-        if (line & 0x2)  TFT_ST7735_drawPixel(x + i, y + 1, color);
-        if (line & 0x4)  TFT_ST7735_drawPixel(x + i, y + 2, color);
-        if (line & 0x8)  TFT_ST7735_drawPixel(x + i, y + 3, color);
-        if (line & 0x10) TFT_ST7735_drawPixel(x + i, y + 4, color);
-        if (line & 0x20) TFT_ST7735_drawPixel(x + i, y + 5, color);
-        if (line & 0x40) TFT_ST7735_drawPixel(x + i, y + 6, color);
-        if (line & 0x80) TFT_ST7735_drawPixel(x + i, y + 7, color);
-      }
-    }
-    else {  // big size
-      for (int8_t i = 0; i < 5; i++ ) {
-        uint8_t line = TFT_ST7735_PGM_READ_BYTE(font + c*5 + i);
-        for (int8_t j = 0; j < 8; j++) {
-          if (line & 0x1) TFT_ST7735_fillRect(x + (i * size), y + (j * size), size, size, color);
-          else if (fillbg) TFT_ST7735_fillRect(x + i * size, y + j * size, size, size, bg);
-          line >>= 1;
-        }
-      }
+      if (line & (1 << j)) rows[j] |= 0x80 >> i;
     }
   }
+
+  // With a background the whole character is one window, else one window per run
+  if (bg != color) TFT_ST7735_writeBitmapBlock(x, y, rows, 1, 6, 8, size, color, bg);
+  else             TFT_ST7735_writeBitmapRuns(x, y, rows, 1, 6, 8, size, color);
 #endif // LOAD_GLCD
 }
 
@@ -1089,6 +1542,9 @@ void TFT_ST7735_setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
   addr_row = 0xFF;
   addr_col = 0xFF;
 
+  // Don't toggle DC while a previous block of pixels is still being sent
+  TFT_ST7735_Wait_SPI();
+
   // Column addr set
   TFT_ST7735_Set_Data_Command(REQUEST_COMMAND);
   TFT_ST7735_Set_Chip_Select(CHIP_SELECT_LOW);
@@ -1500,58 +1956,63 @@ void TFT_ST7735_setRotation(uint8_t m)
   addr_row = 0xFF;
   addr_col = 0xFF;
 
+#ifdef TFT_ST7735_FIXED_ROTATION
+  // Only the rotation set at build time is available
+  (void)m;
+  TFT_ST7735_writecommand(ST7735_MADCTL);
+#else
   rotation = m % 4;
 
   TFT_ST7735_writecommand(ST7735_MADCTL);
   switch (rotation) {
     case 0:
      if (tabcolor == INITR_BLACKTAB) {
-       TFT_ST7735_writedata(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
+       madctl = MADCTL_MX | MADCTL_MY | MADCTL_RGB;
      } else if(tabcolor == INITR_GREENTAB2) {
-       TFT_ST7735_writedata(MADCTL_MX | MADCTL_MY | MADCTL_RGB);
+       madctl = MADCTL_MX | MADCTL_MY | MADCTL_RGB;
        colstart = 2;
        rowstart = 1;
      } else {
-       TFT_ST7735_writedata(MADCTL_MX | MADCTL_MY | MADCTL_BGR);
+       madctl = MADCTL_MX | MADCTL_MY | MADCTL_BGR;
      }
       _width  = ST7735_TFTWIDTH;
       _height = ST7735_TFTHEIGHT;
       break;
     case 1:
      if (tabcolor == INITR_BLACKTAB) {
-       TFT_ST7735_writedata(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
+       madctl = MADCTL_MY | MADCTL_MV | MADCTL_RGB;
      } else if(tabcolor == INITR_GREENTAB2) {
-       TFT_ST7735_writedata(MADCTL_MY | MADCTL_MV | MADCTL_RGB);
+       madctl = MADCTL_MY | MADCTL_MV | MADCTL_RGB;
        colstart = 1;
        rowstart = 2;
      } else {
-       TFT_ST7735_writedata(MADCTL_MY | MADCTL_MV | MADCTL_BGR);
+       madctl = MADCTL_MY | MADCTL_MV | MADCTL_BGR;
      }
       _width  = ST7735_TFTHEIGHT;
       _height = ST7735_TFTWIDTH;
       break;
     case 2:
      if (tabcolor == INITR_BLACKTAB) {
-       TFT_ST7735_writedata(MADCTL_RGB);
+       madctl = MADCTL_RGB;
      } else if(tabcolor == INITR_GREENTAB2) {
-       TFT_ST7735_writedata(MADCTL_RGB);
+       madctl = MADCTL_RGB;
        colstart = 2;
        rowstart = 1;
      } else {
-       TFT_ST7735_writedata(MADCTL_BGR);
+       madctl = MADCTL_BGR;
      }
       _width  = ST7735_TFTWIDTH;
       _height = ST7735_TFTHEIGHT;
       break;
     case 3:
      if (tabcolor == INITR_BLACKTAB) {
-       TFT_ST7735_writedata(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
+       madctl = MADCTL_MX | MADCTL_MV | MADCTL_RGB;
      } else if(tabcolor == INITR_GREENTAB2) {
-       TFT_ST7735_writedata(MADCTL_MX | MADCTL_MV | MADCTL_RGB);
+       madctl = MADCTL_MX | MADCTL_MV | MADCTL_RGB;
        colstart = 1;
        rowstart = 2;
      } else {
-       TFT_ST7735_writedata(MADCTL_MX | MADCTL_MV | MADCTL_BGR);
+       madctl = MADCTL_MX | MADCTL_MV | MADCTL_BGR;
      }
       _width  = ST7735_TFTHEIGHT;
       _height = ST7735_TFTWIDTH;
@@ -1580,6 +2041,8 @@ void TFT_ST7735_setRotation(uint8_t m)
       break;
   */
   }
+#endif // TFT_ST7735_FIXED_ROTATION
+  TFT_ST7735_writedata(madctl);
 }
 
 /***************************************************************************************
@@ -1621,6 +2084,7 @@ size_t TFT_ST7735_write(uint8_t uniCode)
 
 
 #ifdef LOAD_RLE
+  if (textfont < TFT_LOADED_FONT)
   {
       // Uses the fontinfo struct array to avoid lots of 'if' or 'switch' statements
       // A tad slower than above but this is not significant and is more convenient for the RLE fonts
@@ -1640,6 +2104,14 @@ size_t TFT_ST7735_write(uint8_t uniCode)
   if (textfont==1) return 0;
 #endif
 
+  if (textfont == TFT_LOADED_FONT)
+  {
+      const fontglyph *g = TFT_ST7735_findGlyph(loadedfont, uniCode);
+      if (!loadedfont) return 0;
+      width  = g ? g->advance : 0;
+      height = loadedfont->height;
+  }
+
   height = height * textsize;
 
   if (uniCode == '\n') {
@@ -1658,130 +2130,545 @@ size_t TFT_ST7735_write(uint8_t uniCode)
   return 1;
 }
 
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
 /***************************************************************************************
-** Function name:           TFT_ST7735_drawChar
-** Description:             draw a unicode onto the screen
+** Function name:           glyphCacheFlush
+** Description:             Empty the glyph cache and clear its counters
 ***************************************************************************************/
-int TFT_ST7735_drawChar_uniCode(unsigned int uniCode, int x, int y, int font)
+void TFT_ST7735_glyphCacheFlush(void)
 {
+  TFT_ST7735_Wait_SPI(); // The arena may still be in use by a transfer
+  glyph_count = 0;
+  glyph_arena_used = 0;
+  glyph_hits = 0;
+  glyph_misses = 0;
+}
 
-  if (font==1)
-  {
-#ifdef LOAD_GLCD
-      TFT_ST7735_drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
-      return 6 * textsize;
-#else
-      return 0;
-#endif
+/***************************************************************************************
+** Function name:           glyphCacheStats
+** Description:             Report the glyph cache hit and miss counters
+***************************************************************************************/
+void TFT_ST7735_glyphCacheStats(uint32_t *hits, uint32_t *misses)
+{
+  *hits = glyph_hits;
+  *misses = glyph_misses;
+}
+
+/***************************************************************************************
+** Function name:           drawCachedGlyph
+** Description:             Send a character from the glyph arena as a single block
+***************************************************************************************/
+static int TFT_ST7735_drawCachedGlyph(unsigned int uniCode, int x, int y, int font)
+{
+  uint8_t i;
+  glyphentry *e = 0;
+
+  for (i = 0; i < glyph_count; i++) {
+    e = &glyph_entry[i];
+    if ((e->uniCode == uniCode) && (e->font == font) && (e->size == textsize) &&
+        (e->fg == textcolor) && (e->bg == textbgcolor)) break;
   }
 
-  unsigned int width  = 0;
-  unsigned int height = 0;
-  const uint8_t* flash_address = 0;
-  uniCode -= 32;
+  if (i == glyph_count) {
+    // Not cached, work out the image size as drawn by drawChar_uniCode()
+    uint16_t w = 0, h = 0, advance = 0;
 
+    if ((font == 1) && (uniCode < 255)) {
+#ifdef LOAD_GLCD
+      w = advance = 6;
+      h = 8;
+#endif
+    }
+    else if ((uniCode >= 32) && (uniCode < 128) && fontdata[font].widthtbl) {
+      advance = TFT_ST7735_PGM_READ_BYTE(fontdata[font].widthtbl + uniCode - 32);
+      w = advance;
+      h = fontdata[font].height;
 #ifdef LOAD_FONT2
-  if (font == 2)
-  {
-      flash_address = chrtbl_f16[uniCode];
-      width = TFT_ST7735_PGM_READ_BYTE(widtbl_f16 + uniCode);
-      height = chr_hgt_f16;
-  }
-  #ifdef LOAD_RLE
-  else
-  #endif
+      if (font == 2) w = ((w + 6) / 8) * 8; // Font 2 is drawn in whole bytes
 #endif
+    }
+    w *= textsize;
+    h *= textsize;
+    advance *= textsize;
+
+    uint32_t bytes = (uint32_t)w * h * 2;
+    if ((bytes == 0) || (bytes > sizeof(glyph_arena))) {
+      glyph_misses++;
+      return -1;
+    }
 
-#ifdef LOAD_RLE
-  {
-      flash_address = fontdata[font].chartbl + uniCode;
-      width = TFT_ST7735_PGM_READ_BYTE(fontdata[font].widthtbl + uniCode);
-      height = fontdata[font].height;
-  }
-#endif
+    // A character that cannot be sent as one block is not worth an eviction
+    if ((x < 0) || (y < 0) || (x + w > _width) || (y + h > _height)) return -1;
 
-  int w = width;
-  int pX      = 0;
-  int pY      = y;
-  uint8_t line = 0;
+    // The arena is rewritten below, so any transfer from it must be over
+    TFT_ST7735_Wait_SPI();
+
+    // Evict least recently used entries until the image fits at the end of the arena
+    while ((glyph_count == TFT_ST7735_GLYPH_CACHE_ENTRIES) ||
+           (glyph_arena_used + bytes > sizeof(glyph_arena))) {
+      uint8_t lru = 0;
+      for (i = 1; i < glyph_count; i++) {
+        if (glyph_entry[i].used < glyph_entry[lru].used) lru = i;
+      }
+
+      uint16_t start = glyph_entry[lru].offset;
+      uint16_t size = glyph_entry[lru].w * glyph_entry[lru].h * 2;
+      memmove(&glyph_arena[start], &glyph_arena[start + size], glyph_arena_used - start - size);
+      glyph_arena_used -= size;
+
+      for (i = lru; i < glyph_count - 1; i++) {
+        glyph_entry[i] = glyph_entry[i + 1];
+        glyph_entry[i].offset -= size;
+      }
+      glyph_count--;
+    }
+
+    e = &glyph_entry[glyph_count++];
+    e->uniCode = uniCode;
+    e->font    = font;
+    e->size    = textsize;
+    e->fg      = textcolor;
+    e->bg      = textbgcolor;
+    e->w       = w;
+    e->h       = h;
+    e->advance = advance;
+    e->offset  = glyph_arena_used;
+    glyph_arena_used += bytes;
+
+    TFT_ST7735_renderGlyph(&glyph_arena[e->offset], uniCode, font, w, h);
+    glyph_misses++;
+  }
+  else {
+    // The block write needs the whole character on screen
+    if ((x < 0) || (y < 0) || (x + e->w > _width) || (y + e->h > _height)) return -1;
+    glyph_hits++;
+  }
+
+  e->used = ++glyph_clock;
+
+  TFT_ST7735_setWindow(x, y, x + e->w - 1, y + e->h - 1);
+  TFT_ST7735_Write_SPI(&glyph_arena[e->offset], (uint32_t)e->w * e->h * 2);
+  TFT_ST7735_writeEnd();
+
+  return e->advance;
+}
+
+/***************************************************************************************
+** Function name:           renderGlyph
+** Description:             Expand a character into an RGB565 image in RAM
+***************************************************************************************/
+static void TFT_ST7735_renderGlyph(uint8_t *img, unsigned int uniCode, int fontnum, uint16_t w, uint16_t h)
+{
+  uint8_t fh = textcolor >> 8, fl = textcolor;
+  uint8_t size = textsize;
+  uint16_t px, py, sx, sy;
+  uint8_t *p;
+
+  // Background first, then the foreground pixels as size x size blocks
+  p = img;
+  for (uint32_t n = (uint32_t)w * h; n; n--) {
+    *p++ = textbgcolor >> 8;
+    *p++ = textbgcolor;
+  }
+
+#define TFT_ST7735_GLYPH_DOT(gx, gy) \
+  for (sy = 0; sy < size; sy++) { \
+    p = img + ((((gy) * size + sy) * w) + (gx) * size) * 2; \
+    for (sx = 0; sx < size; sx++) { *p++ = fh; *p++ = fl; } \
+  }
+
+  if (fontnum == 1) {
+#ifdef LOAD_GLCD
+    for (px = 0; px < 5; px++) {
+      uint8_t line = TFT_ST7735_PGM_READ_BYTE(font + uniCode * 5 + px);
+      for (py = 0; py < 8; py++) {
+        if (line & (1 << py)) { TFT_ST7735_GLYPH_DOT(px, py); }
+      }
+    }
+#endif
+    return;
+  }
 
-  uint8_t tl = textcolor;
-  uint8_t th = textcolor >> 8;
-  uint8_t bl = textbgcolor;
-  uint8_t bh = textbgcolor >> 8;
+  uniCode -= 32;
 
 #ifdef LOAD_FONT2
-  if (font == 2) {
-    w = w + 6; // Should be + 7 but we need to compensate for width increment
-    w = w / 8;
-    if (x + width * textsize >= _width) return width * textsize ;
+  if (fontnum == 2) {
+    const uint8_t *flash_address = chrtbl_f16[uniCode];
+    uint8_t wb = (TFT_ST7735_PGM_READ_BYTE(widtbl_f16 + uniCode) + 6) / 8;
+
+    for (py = 0; py < chr_hgt_f16; py++) {
+      for (px = 0; px < wb * 8; px++) {
+        if (TFT_ST7735_PGM_READ_BYTE(flash_address + wb * py + (px >> 3)) & (0x80 >> (px & 7))) {
+          TFT_ST7735_GLYPH_DOT(px, py);
+        }
+      }
+    }
+    return;
+  }
+#endif
 
-    if (textcolor == textbgcolor || textsize != 1) {
+#ifdef LOAD_RLE
+  {
+    const uint8_t *flash_address = ((const uint8_t * const *)fontdata[fontnum].chartbl)[uniCode];
+    uint16_t width = w / size;
+    uint32_t pc = 0, total = (uint32_t)width * (h / size);
+
+    while (pc < total) {
+      uint8_t line = TFT_ST7735_PGM_READ_BYTE(flash_address++);
+      uint8_t run = (line & 0x7F) + 1;
+
+      if (line & 0x80) {
+        while (run--) {
+          px = pc % width;
+          py = pc / width;
+          TFT_ST7735_GLYPH_DOT(px, py);
+          pc++;
+        }
+      }
+      else pc += run;
+    }
+  }
+#endif
 
-      for (unsigned int i = 0; i < height; i++)
-      {
-        if (textcolor != textbgcolor) TFT_ST7735_fillRect(x, pY, width * textsize, textsize, textbgcolor);
+#undef TFT_ST7735_GLYPH_DOT
+}
+#endif // TFT_ST7735_GLYPH_CACHE_BYTES
 
-        for (int k = 0; k < w; k++)
-        {
-          line = TFT_ST7735_PGM_READ_BYTE(flash_address + (w * i) + k);
-          if (line) {
-            if (textsize == 1) {
-              pX = x + k * 8;
-              if (line & 0x80) TFT_ST7735_drawPixel(pX, pY, textcolor);
-              if (line & 0x40) TFT_ST7735_drawPixel(pX + 1, pY, textcolor);
-              if (line & 0x20) TFT_ST7735_drawPixel(pX + 2, pY, textcolor);
-              if (line & 0x10) TFT_ST7735_drawPixel(pX + 3, pY, textcolor);
-              if (line & 0x08) TFT_ST7735_drawPixel(pX + 4, pY, textcolor);
-              if (line & 0x04) TFT_ST7735_drawPixel(pX + 5, pY, textcolor);
-              if (line & 0x02) TFT_ST7735_drawPixel(pX + 6, pY, textcolor);
-              if (line & 0x01) TFT_ST7735_drawPixel(pX + 7, pY, textcolor);
-            }
-            else {
-              pX = x + k * 8 * textsize;
-              if (line & 0x80) TFT_ST7735_fillRect(pX, pY, textsize, textsize, textcolor);
-              if (line & 0x40) TFT_ST7735_fillRect(pX + textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x20) TFT_ST7735_fillRect(pX + 2 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x10) TFT_ST7735_fillRect(pX + 3 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x08) TFT_ST7735_fillRect(pX + 4 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x04) TFT_ST7735_fillRect(pX + 5 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x02) TFT_ST7735_fillRect(pX + 6 * textsize, pY, textsize, textsize, textcolor);
-              if (line & 0x01) TFT_ST7735_fillRect(pX + 7 * textsize, pY, textsize, textsize, textcolor);
-            }
-          }
+/***************************************************************************************
+** Function name:           loadFont
+** Description:             Select the indexed font drawn as TFT_LOADED_FONT, 0 unloads
+***************************************************************************************/
+void TFT_ST7735_loadFont(const fontindexed *font)
+{
+  loadedfont = font;
+
+#ifdef TFT_ST7735_METRICS_CACHE_ENTRIES
+  TFT_ST7735_metricsCacheFlush(); // Widths in the loaded font are no longer valid
+#endif
+
+  if (font) fontsloaded |= (1 << TFT_LOADED_FONT);
+  else      fontsloaded &= ~(1 << TFT_LOADED_FONT);
+}
+
+/***************************************************************************************
+** Function name:           decodeUTF8
+** Description:             Read one character from a UTF-8 string
+***************************************************************************************/
+static unsigned int TFT_ST7735_decodeUTF8(char **string)
+{
+  const uint8_t *s = (const uint8_t *)*string;
+  unsigned int c = s[0];
+  uint8_t extra = 0, i;
+
+  if      ((c & 0xF8) == 0xF0) extra = 3;
+  else if ((c & 0xF0) == 0xE0) extra = 2;
+  else if ((c & 0xE0) == 0xC0) extra = 1;
+
+  for (i = 1; i <= extra; i++) {
+    if ((s[i] & 0xC0) != 0x80) extra = 0; // Not UTF-8, use the byte as it is
+  }
+
+  if (extra) {
+    c &= 0x3F >> extra;
+    for (i = 1; i <= extra; i++) c = (c << 6) | (s[i] & 0x3F);
+  }
+
+  *string += extra + 1;
+  return c;
+}
+
+/***************************************************************************************
+** Function name:           findGlyph
+** Description:             Look up a character in an indexed font
+***************************************************************************************/
+static const fontglyph* TFT_ST7735_findGlyph(const fontindexed *f, unsigned int uniCode)
+{
+  if (!f || (uniCode < f->first) || (uniCode > f->last)) return 0;
+
+  if (!f->codes) return &f->glyph[uniCode - f->first];
+
+  // Binary search of the sorted code list
+  uint16_t lo = 0, hi = f->count;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) >> 1;
+    uint16_t code = f->codes[mid];
+    if (code == uniCode) return &f->glyph[mid];
+    if (code < uniCode) lo = mid + 1;
+    else                hi = mid;
+  }
+  return 0;
+}
+
+/***************************************************************************************
+** Function name:           decodeIndexedRow
+** Description:             Expand one row of an indexed glyph into pixel levels
+***************************************************************************************/
+static const uint8_t* TFT_ST7735_decodeIndexedRow(const uint8_t *data, uint8_t w, uint8_t bpp,
+                                                  uint8_t *level, int16_t px, int16_t cw)
+{
+  int16_t c = 0, i;
+  uint8_t line, n, value;
+  uint8_t max = (1 << bpp) - 1;
+
+  while (c < w) {
+    line = TFT_ST7735_PGM_READ_BYTE(data++);
+
+    if (bpp == 1) {
+      // Bit 7 set is a foreground run, else a background run
+      n = (line & 0x7F) + 1;
+      value = (line & 0x80) ? 1 : 0;
+    }
+    else if (!(line & 0x80)) {
+      // 00nnnnnn background run, 01nnnnnn full colour run
+      n = (line & 0x3F) + 1;
+      value = (line & 0x40) ? max : 0;
+    }
+    else {
+      // 1nnnnnnn is followed by n + 1 packed levels, MSB first
+      uint8_t bits = 0, byte = 0;
+
+      n = (line & 0x7F) + 1;
+      for (i = 0; i < n; i++) {
+        if (!bits) {
+          byte = TFT_ST7735_PGM_READ_BYTE(data++);
+          bits = 8;
         }
-        pY += textsize;
+        bits -= bpp;
+        if (level && (px + c + i >= 0) && (px + c + i < cw)) level[px + c + i] = (byte >> bits) & max;
       }
+      c += n;
+      continue;
     }
-    else
-      // Faster drawing of characters and background using block write
-    {
 
-      TFT_ST7735_setWindow(x, y, (x + w * 8) - 1, y + height - 1);
+    if (value && level) {
+      int16_t i0 = px + c, i1 = px + c + n;
+      if (i0 < 0) i0 = 0;
+      if (i1 > cw) i1 = cw;
+      for (; i0 < i1; i0++) level[i0] = value;
+    }
+    c += n;
+  }
+  return data;
+}
 
-      uint8_t mask;
-      for (unsigned int i = 0; i < height; i++)
-      {
-        for (int k = 0; k < w; k++)
-        {
-          line = TFT_ST7735_PGM_READ_BYTE(flash_address + w * i + k);
-          pX = x + k * 8;
-          mask = 0x80;
-          while (mask) {
-            if (line & mask) {
-                TFT_ST7735_WRITE_BYTE_SPI(th);
-                TFT_ST7735_WRITE_BYTE_SPI(tl);
-            }
-            else {
-                TFT_ST7735_WRITE_BYTE_SPI(bh);
-                TFT_ST7735_WRITE_BYTE_SPI(bl);
+/***************************************************************************************
+** Function name:           setRamp
+** Description:             Work out the colours between the text background and colour
+***************************************************************************************/
+static void TFT_ST7735_setRamp(uint8_t bpp)
+{
+  uint8_t i, max = (1 << bpp) - 1;
+
+  if ((ramp_bpp == bpp) && (ramp_fg == textcolor) && (ramp_bg == textbgcolor)) return;
+
+  // Each channel is interpolated on its own, once per colour change
+  int16_t fr = textcolor >> 11, fg = (textcolor >> 5) & 0x3F, fb = textcolor & 0x1F;
+  int16_t br = textbgcolor >> 11, bg = (textbgcolor >> 5) & 0x3F, bb = textbgcolor & 0x1F;
+
+  for (i = 0; i <= max; i++) {
+    uint16_t r = br + ((fr - br) * i + max / 2) / max;
+    uint16_t g = bg + ((fg - bg) * i + max / 2) / max;
+    uint16_t b = bb + ((fb - bb) * i + max / 2) / max;
+    uint16_t color = (r << 11) | (g << 5) | b;
+
+    ramp[i][0] = color >> 8;
+    ramp[i][1] = color;
+  }
+
+  ramp_fg  = textcolor;
+  ramp_bg  = textbgcolor;
+  ramp_bpp = bpp;
+}
+
+/***************************************************************************************
+** Function name:           drawIndexedChar
+** Description:             Draw a character of the loaded indexed font
+***************************************************************************************/
+static int TFT_ST7735_drawIndexedChar(unsigned int uniCode, int x, int y)
+{
+  const fontindexed *f = loadedfont;
+  const fontglyph *g = TFT_ST7735_findGlyph(f, uniCode);
+
+  if (!g) return 0;
+
+  const uint8_t *data = f->bitmap + g->offset;
+  uint8_t bpp = f->bpp ? f->bpp : 1;
+  uint8_t level[256]; // Levels of one row, the widest cell an 8 bit advance allows
+  int16_t size = textsize;
+  int16_t r, i;
+
+  if (textcolor == textbgcolor) {
+    // Nothing to blend with, pixels of at least half level are drawn as runs,
+    // each one a clipped window
+    uint8_t half = 1 << (bpp - 1);
+    uint8_t drawn = 0;
+
+    for (r = 0; r < g->height; r++) {
+      int16_t y0 = y + (g->yOffset + r) * size;
+      int16_t y1 = y0 + size - 1;
+
+      for (i = 0; i < g->width; i++) level[i] = 0;
+      data = TFT_ST7735_decodeIndexedRow(data, g->width, bpp, level, 0, g->width);
+
+      if (y0 < 0) y0 = 0;
+      if (y1 >= _height) y1 = _height - 1;
+      if (y0 > y1) continue;
+
+      for (i = 0; i < g->width; ) {
+        if (level[i] < half) {
+          i++;
+          continue;
+        }
+
+        int16_t start = i;
+        while ((i < g->width) && (level[i] >= half)) i++;
+
+        int16_t x0 = x + (g->xOffset + start) * size;
+        int16_t x1 = x + (g->xOffset + i) * size - 1;
+        if (x0 < 0) x0 = 0;
+        if (x1 >= _width) x1 = _width - 1;
+
+        if (x0 <= x1) {
+          TFT_ST7735_setWindow(x0, y0, x1, y1);
+          TFT_ST7735_writeColor(textcolor, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+          drawn = 1;
+        }
+      }
+    }
+
+    if (drawn) TFT_ST7735_writeEnd();
+  }
+  else {
+    // The whole cell is one window, each glyph row is decoded into levels
+    // and sent textsize times through the colour ramp and the line buffers
+    int16_t cw = g->advance, ch = f->height;
+    uint8_t rep, dup;
+
+    int16_t left   = (x < 0) ? (size - 1 - x) / size : 0;
+    int16_t top    = (y < 0) ? (size - 1 - y) / size : 0;
+    int16_t right  = (x + cw * size > _width)  ? (_width  - x) / size : cw;
+    int16_t bottom = (y + ch * size > _height) ? (_height - y) / size : ch;
+    if ((left >= right) || (top >= bottom)) return cw * size;
+
+    TFT_ST7735_setRamp(bpp);
+
+    // Rows of the glyph above the cell are skipped
+    for (r = g->yOffset; (r < 0) && (r - g->yOffset < g->height); r++) {
+      data = TFT_ST7735_decodeIndexedRow(data, g->width, bpp, 0, 0, 0);
+    }
+
+    TFT_ST7735_setWindow(x + left * size, y + top * size, x + right * size - 1, y + bottom * size - 1);
+
+    uint8_t *buf = TFT_ST7735_getLineBuffer();
+    uint16_t n = 0;
+
+    for (r = 0; r < bottom; r++) {
+      int16_t gr = r - g->yOffset; // Glyph row
+
+      for (i = 0; i < cw; i++) level[i] = 0;
+      if ((gr >= 0) && (gr < g->height)) {
+        data = TFT_ST7735_decodeIndexedRow(data, g->width, bpp, level, g->xOffset, cw);
+      }
+      if (r < top) continue;
+
+      for (rep = 0; rep < size; rep++) {
+        for (i = left; i < right; i++) {
+          const uint8_t *color = ramp[level[i]];
+
+          for (dup = 0; dup < size; dup++) {
+            buf[n++] = color[0];
+            buf[n++] = color[1];
+
+            if (n == sizeof(linebuf[0])) {
+              TFT_ST7735_Write_SPI(buf, n);
+              buf = TFT_ST7735_getLineBuffer();
+              n = 0;
             }
-            mask = mask >> 1;
           }
         }
-        pY += textsize;
       }
-      TFT_ST7735_writeEnd();
+    }
+
+    if (n) TFT_ST7735_Write_SPI(buf, n);
+
+    TFT_ST7735_writeEnd();
+  }
+
+  return g->advance * size;
+}
+
+/***************************************************************************************
+** Function name:           TFT_ST7735_drawChar
+** Description:             draw a unicode onto the screen
+***************************************************************************************/
+int TFT_ST7735_drawChar_uniCode(unsigned int uniCode, int x, int y, int font)
+{
+  if (font == TFT_LOADED_FONT) return TFT_ST7735_drawIndexedChar(uniCode, x, y);
+
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+  // Text with a background can be sent as one block from the glyph cache
+  if (textcolor != textbgcolor) {
+    int advance = TFT_ST7735_drawCachedGlyph(uniCode, x, y, font);
+    if (advance >= 0) return advance;
+  }
+#endif
+
+
+  if (font==1)
+  {
+#ifdef LOAD_GLCD
+      if (uniCode > 254) return 0; // The GLCD font holds characters 0 to 254
+      TFT_ST7735_drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
+      return 6 * textsize;
+#else
+      return 0;
+#endif
+  }
+
+  // The other fonts only hold the 96 characters from 32 to 127
+  if ((uniCode < 32) || (uniCode > 127)) return 0;
+
+  unsigned int width  = 0;
+  unsigned int height = 0;
+  const uint8_t* flash_address = 0;
+  uniCode -= 32;
+
+#ifdef LOAD_FONT2
+  if (font == 2)
+  {
+      flash_address = chrtbl_f16[uniCode];
+      width = TFT_ST7735_PGM_READ_BYTE(widtbl_f16 + uniCode);
+      height = chr_hgt_f16;
+  }
+  #ifdef LOAD_RLE
+  else
+  #endif
+#endif
+
+#ifdef LOAD_RLE
+  {
+      flash_address = ((const uint8_t * const *)fontdata[font].chartbl)[uniCode];
+      width = TFT_ST7735_PGM_READ_BYTE(fontdata[font].widthtbl + uniCode);
+      height = fontdata[font].height;
+  }
+#endif
+
+  int w = width;
+  int pY      = y;
+  uint8_t line = 0;
+
+#ifdef LOAD_FONT2
+  if (font == 2) {
+    w = w + 6; // Should be + 7 but we need to compensate for width increment
+    w = w / 8;
+    if (x + width * textsize >= _width) return width * textsize ;
+
+    // Rows are whole bytes, MSB left, so the character is sent like a 1 bit image
+    if (textcolor != textbgcolor) {
+      TFT_ST7735_writeBitmapBlock(x, y, flash_address, w, w * 8, height, textsize, textcolor, textbgcolor);
+    }
+    else {
+      TFT_ST7735_writeBitmapRuns(x, y, flash_address, w, w * 8, height, textsize, textcolor);
     }
   }
 
@@ -1793,58 +2680,38 @@ int TFT_ST7735_drawChar_uniCode(unsigned int uniCode, int x, int y, int font)
 #ifdef LOAD_RLE  //674 bytes of code
   // Font is not 2 and hence is RLE encoded
   {
-      // Dummy write to ensure SPIF flag gets set for first check in while() loop
-      TFT_ST7735_WRITE_BYTE_SPI(0);
-
     w *= height; // Now w is total number of pixels in the character
     if ((textsize != 1) || (textcolor == textbgcolor)) {
       if (textcolor != textbgcolor) TFT_ST7735_fillRect(x, pY, width * textsize, textsize * height, textbgcolor);
-      int px = 0, py = pY; // To hold character block start and end column and row values
+      int px, py; // Position in the character of the current run, in font pixels
       int pc = 0; // Pixel count
-      uint8_t np = textsize * textsize; // Number of pixels in a drawn pixel
-
-      uint8_t tnp = 0; // Temporary copy of np for while loop
-      uint8_t ts = textsize - 1; // Temporary copy of textsize
+      int seg;    // Part of the run that is on the current character row
       // 16 bit pixel count so maximum font size is equivalent to 180x180 pixels in area
       // w is total number of pixels to plot to fill character block
       while (pc < w)
       {
-        line = TFT_ST7735_PGM_READ_BYTE((void**)flash_address);
-        flash_address++; // 20 bytes smaller by incrementing here
+        line = TFT_ST7735_PGM_READ_BYTE(flash_address);
+        flash_address++;
         if (line & 0x80) {
           line &= 0x7F;
           line++;
-          if (ts) {
-            px = x + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = y + textsize * (pc / width);
-          }
-          else {
-            px = x + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = y + pc / width;
-          }
-          while (line--) { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while() as we use up SPI wait time
+          px = pc % width;
+          py = pc / width;
+          pc += line;
 
-            TFT_ST7735_setWindow(px, py, px + ts, py + ts);
+          // A run may continue on the next rows, each row part is one window
+          // and one block of textsize x textsize scaled pixels
+          while (line) {
+            seg = width - px;
+            if (seg > line) seg = line;
 
-            if (ts) {
-              tnp = np;
-              while (tnp--) {
-                  TFT_ST7735_WRITE_BYTE_SPI(th);
-                  TFT_ST7735_WRITE_BYTE_SPI(tl);
-              }
-            }
-            else {
-                TFT_ST7735_WRITE_BYTE_SPI(th);
-                TFT_ST7735_WRITE_BYTE_SPI(tl);
-            }
-            px += textsize;
+            TFT_ST7735_setWindow(x + px * textsize, y + py * textsize,
+                                 x + (px + seg) * textsize - 1, y + (py + 1) * textsize - 1);
+            TFT_ST7735_writeColor(textcolor, (uint32_t)seg * textsize * textsize);
 
-            if (px >= (x + width * textsize))
-            {
-              px = x;
-              py += textsize;
-            }
+            line -= seg;
+            px = 0;
+            py++;
           }
         }
         else {
@@ -1895,18 +2762,91 @@ int TFT_ST7735_drawChar_uniCode(unsigned int uniCode, int x, int y, int font)
 ** Description :            draw string with padding if it is defined
 ***************************************************************************************/
 int TFT_ST7735_drawString(char *string, int poX, int poY, int font)
+{
+  return TFT_ST7735_drawStringLayout(string, poX, poY, font, 1);
+}
+
+#ifdef TFT_ST7735_METRICS_CACHE_ENTRIES
+/***************************************************************************************
+** Function name:           metricsCacheFlush
+** Description:             Forget the string widths kept by drawString()
+***************************************************************************************/
+void TFT_ST7735_metricsCacheFlush(void)
+{
+  uint8_t i;
+
+  for (i = 0; i < TFT_ST7735_METRICS_CACHE_ENTRIES; i++) metrics_entry[i].string = 0;
+  metrics_next = 0;
+}
+#endif
+
+/***************************************************************************************
+** Function name:           drawStringLayout
+** Description :            measure and draw a string with a single pass over it
+***************************************************************************************/
+static int TFT_ST7735_drawStringLayout(char *string, int poX, int poY, int font, uint8_t cached)
 {
   int16_t sumX = 0;
   uint8_t padding = 1;
   unsigned int cheight = 0;
+  unsigned int layout[TFT_ST7735_LAYOUT_CHARS]; // Characters decoded while measuring
+  uint8_t count = 0, i;
 
   if (textdatum || padX)
   {
+    int32_t width = -1;
+
+#ifdef TFT_ST7735_METRICS_CACHE_ENTRIES
+    const char *key = string;
+
+    if (cached)
+    {
+      for (i = 0; i < TFT_ST7735_METRICS_CACHE_ENTRIES; i++)
+      {
+        if ((metrics_entry[i].string == key) && (metrics_entry[i].font == font))
+        {
+          width = metrics_entry[i].width;
+          break;
+        }
+      }
+    }
+#else
+    (void)cached;
+#endif
+
+    if (width < 0)
+    {
+      // Measure the string, the first characters are kept so they are
+      // not decoded again when drawn
+      char *next = string;
+      width = 0;
+      while (*next)
+      {
+        unsigned int uniCode = TFT_ST7735_decodeUTF8(&next);
+        width += TFT_ST7735_charWidth(uniCode, font);
+        if (count < TFT_ST7735_LAYOUT_CHARS)
+        {
+          layout[count++] = uniCode;
+          string = next;
+        }
+      }
+
+#ifdef TFT_ST7735_METRICS_CACHE_ENTRIES
+      if (cached)
+      {
+        metrics_entry[metrics_next].string = key;
+        metrics_entry[metrics_next].width  = width;
+        metrics_entry[metrics_next].font   = font;
+        if (++metrics_next == TFT_ST7735_METRICS_CACHE_ENTRIES) metrics_next = 0;
+      }
+#endif
+    }
+
     // Find the pixel width of the string in the font
-    unsigned int cwidth  = TFT_ST7735_textWidth(string, font);
+    unsigned int cwidth  = width * textsize;
 
     // Get the pixel height of the font
-    cheight = TFT_ST7735_PGM_READ_BYTE( &fontdata[font].height ) * textsize;
+    cheight = TFT_ST7735_fontHeight(font);
 
     switch(textdatum) {
       case TC_DATUM:
@@ -1953,7 +2893,8 @@ int TFT_ST7735_drawString(char *string, int poX, int poY, int font)
     if (poY+cheight>_height) poY = _height - cheight;
   }
 
-  while (*string) sumX += TFT_ST7735_drawChar_uniCode(*(string++), poX+sumX, poY, font);
+  for (i = 0; i < count; i++) sumX += TFT_ST7735_drawChar_uniCode(layout[i], poX+sumX, poY, font);
+  while (*string) sumX += TFT_ST7735_drawChar_uniCode(TFT_ST7735_decodeUTF8(&string), poX+sumX, poY, font);
 
 //#define PADDING_DEBUG
 
@@ -2042,7 +2983,7 @@ int TFT_ST7735_drawNumber(long long_num, int poX, int poY, int font)
 {
   char str[12];
   TFT_ST7735_ltoa(long_num, str, 10);
-  return TFT_ST7735_drawString(str, poX, poY, font);
+  return TFT_ST7735_drawStringLayout(str, poX, poY, font, 0); // str is on the stack, never cached
 }
 
 /***************************************************************************************
@@ -2076,7 +3017,7 @@ int TFT_ST7735_drawFloat(float floatNumber, int dp, int poX, int poY, int font)
   // For error put ... in string and return (all TFT_ST7735 library fonts contain . character)
   if (floatNumber >= 2147483647) {
     strcpy(str, "...");
-    return TFT_ST7735_drawString(str, poX, poY, font);
+    return TFT_ST7735_drawStringLayout(str, poX, poY, font, 0);
   }
   // No chance of overflow from here on
 
@@ -2111,7 +3052,559 @@ int TFT_ST7735_drawFloat(float floatNumber, int dp, int poX, int poY, int font)
   }
   
   // Finally we can plot the string and return pixel length
-  return TFT_ST7735_drawString(str, poX, poY, font);
+  return TFT_ST7735_drawStringLayout(str, poX, poY, font, 0);
+}
+
+/***************************************************************************************
+** Function name:           drawnWidth
+** Description:             Width of a character as drawn with a background
+***************************************************************************************/
+static uint16_t TFT_ST7735_drawnWidth(unsigned int uniCode, int font)
+{
+  uint16_t width = TFT_ST7735_charWidth(uniCode, font);
+
+#ifdef LOAD_FONT2
+  if (font == 2) width = ((width + 6) / 8) * 8; // Same rounding as drawChar_uniCode()
+#endif
+  return width;
+}
+
+/***************************************************************************************
+** Function name:           formatFixed
+** Description:             Format a scaled integer with a fixed number of decimals
+***************************************************************************************/
+static void TFT_ST7735_formatFixed(char *str, int32_t value, uint8_t chars, uint8_t decimals)
+{
+  uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+  uint32_t max = 1;
+  int8_t   room = chars - (decimals ? 1 : 0) - (value < 0 ? 1 : 0); // Digits that fit, the sign always has its place
+  uint8_t  least = decimals + 1; // Digits always written, the decimals and a leading zero
+  uint8_t  n = 0, i = chars;
+
+  if (room < 0) room = 0;
+  if (least > room) least = room; // No room for the leading zero, as in "-.99"
+
+  // Clamp to the largest magnitude the field can show
+  if (room > 9) room = 9;
+  while (room-- > 0) max *= 10;
+  if (mag > max - 1) mag = max - 1;
+
+  str[i] = 0;
+  while ((i > 0) && (mag || (n < least))) {
+    if (decimals && (n == decimals)) {
+      str[--i] = '.';
+      if (i == 0) break;
+    }
+    str[--i] = '0' + (mag % 10);
+    mag /= 10;
+    n++;
+  }
+
+  if (decimals && (n == decimals) && (i > 0)) str[--i] = '.';
+  if ((value < 0) && (i > 0)) str[--i] = '-';
+  while (i > 0) str[--i] = ' ';
+}
+
+/***************************************************************************************
+** Function name:           initNumField
+** Description:             Set up a numeric field with the current text colours and size
+***************************************************************************************/
+void TFT_ST7735_initNumField(TFT_ST7735_NumField_T *field, int16_t x, int16_t y, uint8_t chars, uint8_t decimals, uint8_t font, uint8_t datum)
+{
+  int16_t width;
+  unsigned int c;
+
+  if (chars < 1) chars = 1;
+  if (chars > TFT_NUMFIELD_CHARS) chars = TFT_NUMFIELD_CHARS;
+  if (decimals > chars - 2) decimals = (chars > 2) ? chars - 2 : 0; // A leading digit and the point
+
+  field->chars    = chars;
+  field->decimals = decimals;
+  field->font     = font;
+  field->size     = textsize;
+  field->fgcolor  = textcolor;
+  field->bgcolor  = textbgcolor;
+
+  // Every position is as wide as the widest digit, so digits never move
+  field->cellWidth = 0;
+  for (c = '0'; c <= '9'; c++) {
+    width = TFT_ST7735_drawnWidth(c, font) * textsize;
+    if (width > field->cellWidth) field->cellWidth = width;
+  }
+  field->pointWidth = decimals ? TFT_ST7735_drawnWidth('.', font) * textsize : 0;
+  field->height = TFT_ST7735_fontHeight(font);
+
+  // Same datum handling as drawString(), for the whole field
+  width = (chars - (decimals ? 1 : 0)) * field->cellWidth + field->pointWidth;
+  switch (datum % 3) {
+    case 1: x -= width / 2; break;
+    case 2: x -= width;     break;
+  }
+  switch (datum / 3) {
+    case 1: y -= field->height / 2; break;
+    case 2: y -= field->height;     break;
+  }
+  field->x = x;
+  field->y = y;
+
+  field->shown[0] = 0; // Nothing on screen, the first draw paints every cell
+}
+
+/***************************************************************************************
+** Function name:           drawNumField
+** Description:             Draw a value scaled by 10^decimals, only changed cells are sent
+***************************************************************************************/
+uint8_t TFT_ST7735_drawNumField(TFT_ST7735_NumField_T *field, int32_t value)
+{
+  char str[TFT_NUMFIELD_CHARS + 1];
+  uint8_t  i, redrawn = 0;
+  uint8_t  all = (field->shown[0] == 0);
+  int16_t  x = field->x;
+
+  uint16_t fg = textcolor, bg = textbgcolor;
+  uint8_t  size = textsize;
+
+  TFT_ST7735_formatFixed(str, value, field->chars, field->decimals);
+
+  textcolor   = field->fgcolor;
+  textbgcolor = field->bgcolor;
+  textsize    = field->size;
+
+  for (i = 0; i < field->chars; i++) {
+    int16_t cell = (str[i] == '.') ? field->pointWidth : field->cellWidth;
+
+    if (all || (str[i] != field->shown[i])) {
+      // The character is centred in its cell and the rest of the cell cleared,
+      // transparent text (fgcolor == bgcolor) has nothing to clear with
+      int16_t width = TFT_ST7735_drawnWidth((uint8_t)str[i], field->font) * field->size;
+      int16_t pad = (cell - width) / 2;
+      uint8_t opaque = (field->fgcolor != field->bgcolor);
+
+      if (opaque && (pad > 0)) TFT_ST7735_fillRect(x, field->y, pad, field->height, field->bgcolor);
+      if (pad < 0) pad = 0;
+      if (str[i] != ' ') TFT_ST7735_drawChar_uniCode(str[i], x + pad, field->y, field->font);
+      else width = 0;
+      if (opaque && (cell > pad + width)) TFT_ST7735_fillRect(x + pad + width, field->y, cell - pad - width, field->height, field->bgcolor);
+
+      field->shown[i] = str[i];
+      redrawn++;
+    }
+    x += cell;
+  }
+  field->shown[field->chars] = 0;
+
+  textcolor   = fg;
+  textbgcolor = bg;
+  textsize    = size;
+
+  return redrawn;
+}
+
+/***************************************************************************************
+** Function name:           initSevenSeg
+** Description:             Set up a seven segment display with the current text colours and size
+***************************************************************************************/
+void TFT_ST7735_initSevenSeg(TFT_ST7735_SevenSeg_T *display, int16_t x, int16_t y, uint8_t digits, uint8_t decimals, uint8_t datum)
+{
+  int16_t width;
+
+  if (digits < 1) digits = 1;
+  if (digits > TFT_SEVENSEG_DIGITS) digits = TFT_SEVENSEG_DIGITS;
+  if (decimals >= digits) decimals = digits - 1;
+
+  display->digits   = digits;
+  display->decimals = decimals;
+  display->size     = textsize;
+  display->oncolor  = textcolor;
+  display->bgcolor  = textbgcolor;
+  display->offcolor = textbgcolor;
+
+  // Same datum handling as drawString(), for the whole display
+  width = (digits * SEVENSEG_CELL_W + (decimals ? SEVENSEG_POINT_W : 0)) * textsize;
+  switch (datum % 3) {
+    case 1: x -= width / 2; break;
+    case 2: x -= width;     break;
+  }
+  switch (datum / 3) {
+    case 1: y -= SEVENSEG_CELL_H * textsize / 2; break;
+    case 2: y -= SEVENSEG_CELL_H * textsize;     break;
+  }
+  display->x = x;
+  display->y = y;
+
+  display->painted = 0;
+}
+
+/***************************************************************************************
+** Function name:           fillSegment
+** Description:             Fill a bevelled segment, rows with the same span are one rectangle
+***************************************************************************************/
+static void TFT_ST7735_fillSegment(int16_t x, int16_t y, uint8_t size, uint8_t seg, uint16_t color)
+{
+  const uint8_t *b = sevenseg_box[seg];
+  int16_t w = b[2] - b[0] + 1, h = b[3] - b[1] + 1;
+  int16_t half = (((w < h) ? w : h) + 1) / 2; // Half the thickness
+  int16_t r = b[1], r2, inset;
+
+  while (r <= b[3]) {
+    // Rows nearer to an end than half the thickness are inset by one pixel per row
+    int16_t e = (r - b[1] < b[3] - r) ? r - b[1] : b[3] - r;
+    inset = (half - 1 - e > 0) ? half - 1 - e : 0;
+
+    // Extend to the following rows with the same span
+    for (r2 = r; r2 < b[3]; r2++) {
+      int16_t e2 = (r2 + 1 - b[1] < b[3] - r2 - 1) ? r2 + 1 - b[1] : b[3] - r2 - 1;
+      if (((half - 1 - e2 > 0) ? half - 1 - e2 : 0) != inset) break;
+    }
+
+    TFT_ST7735_fillRect(x + (b[0] + inset) * size, y + r * size,
+                        (w - 2 * inset) * size, (r2 - r + 1) * size, color);
+    r = r2 + 1;
+  }
+}
+
+/***************************************************************************************
+** Function name:           drawSevenSeg
+** Description:             Draw a value scaled by 10^decimals, only changed segments are sent
+***************************************************************************************/
+uint8_t TFT_ST7735_drawSevenSeg(TFT_ST7735_SevenSeg_T *display, int32_t value)
+{
+  char str[TFT_SEVENSEG_DIGITS + 2];
+  uint8_t size = display->size;
+  uint8_t i, seg, lit, changed, digit = 0, repainted = 0;
+  int16_t x = display->x;
+
+  TFT_ST7735_formatFixed(str, value, display->digits + (display->decimals ? 1 : 0), display->decimals);
+
+  if (!display->painted) {
+    // Background of the cells, with the decimal point that never moves
+    TFT_ST7735_fillRect(display->x, display->y,
+                        (display->digits * SEVENSEG_CELL_W + (display->decimals ? SEVENSEG_POINT_W : 0)) * size,
+                        SEVENSEG_CELL_H * size, display->bgcolor);
+  }
+
+  for (i = 0; str[i]; i++) {
+    if (str[i] == '.') {
+      if (!display->painted) {
+        // Rounded 5 x 5 dot, as in Font 7
+        TFT_ST7735_fillRect(x + 4 * size, display->y + 42 * size, 3 * size, size, display->oncolor);
+        TFT_ST7735_fillRect(x + 3 * size, display->y + 43 * size, 5 * size, 3 * size, display->oncolor);
+        TFT_ST7735_fillRect(x + 4 * size, display->y + 46 * size, 3 * size, size, display->oncolor);
+      }
+      x += SEVENSEG_POINT_W * size;
+      continue;
+    }
+
+    lit = (str[i] >= '0' && str[i] <= '9') ? sevenseg_digit[str[i] - '0'] :
+                  (str[i] == '-') ? 0x40 : 0x00;
+    changed = display->painted ? (lit ^ display->shown[digit]) : 0x7F;
+
+    for (seg = 0; seg < 7; seg++) {
+      if (!(changed & (1 << seg))) continue;
+
+      if (lit & (1 << seg)) {
+        TFT_ST7735_fillSegment(x, display->y, size, seg, display->oncolor);
+      }
+      else if (display->painted || (display->offcolor != display->bgcolor)) {
+        TFT_ST7735_fillSegment(x, display->y, size, seg, display->offcolor);
+      }
+      else continue; // Already cleared with the background
+
+      repainted++;
+    }
+
+    display->shown[digit++] = lit;
+    x += SEVENSEG_CELL_W * size;
+  }
+
+  display->painted = 1;
+
+  return repainted;
+}
+
+/***************************************************************************************
+** Function name:           initTextBox
+** Description:             Set up a text box with the current text colours and size
+***************************************************************************************/
+void TFT_ST7735_initTextBox(TFT_ST7735_TextBox_T *box, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t font, uint8_t align, uint8_t lineSpacing)
+{
+  // The box is kept on screen so lines never need clipping
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width)  w = _width - x;
+  if (y + h > _height) h = _height - y;
+
+  box->x = x;
+  box->y = y;
+  box->w = (w > 0) ? w : 0;
+  box->h = (h > 0) ? h : 0;
+  box->font  = font;
+  box->size  = textsize;
+  box->align = align;
+  box->lineSpacing = lineSpacing;
+  box->fgcolor = textcolor;
+  box->bgcolor = textbgcolor;
+  box->painted = 0;
+}
+
+/***************************************************************************************
+** Function name:           wrapLine
+** Description:             Find the characters of the next word wrapped line
+***************************************************************************************/
+static int16_t TFT_ST7735_wrapLine(char **text, int16_t maxWidth, int font, char **end)
+{
+  char *s = *text, *next;
+  char *space = 0;        // Last space on the line
+  int16_t width = 0, spaceWidth = 0;
+  uint8_t count = 0;
+
+  while (*s) {
+    next = s;
+    unsigned int uniCode = TFT_ST7735_decodeUTF8(&next);
+
+    if (uniCode == '\n') {
+      *end = s;
+      *text = next;
+      return width;
+    }
+
+    int16_t advance = TFT_ST7735_charWidth(uniCode, font);
+
+    if (((width + advance > maxWidth) || (count == TFT_TEXTBOX_LINE_CHARS)) && count) {
+      if (space) {
+        // Break at the last space, which is dropped
+        *end = space;
+        TFT_ST7735_decodeUTF8(&space);
+        *text = space;
+        return spaceWidth;
+      }
+      // A word wider than the box is broken where it overflows
+      *end = s;
+      *text = s;
+      return width;
+    }
+
+    if (uniCode == ' ') {
+      space = s;
+      spaceWidth = width;
+    }
+    width += advance;
+    count++;
+    s = next;
+  }
+
+  *end = s;
+  *text = s;
+  return width;
+}
+
+/***************************************************************************************
+** Function name:           startTextGlyph
+** Description:             Prepare to decode a text box character row by row
+***************************************************************************************/
+static int16_t TFT_ST7735_startTextGlyph(textglyph *tg, unsigned int uniCode, int fontnum, int16_t x)
+{
+  int16_t advance = TFT_ST7735_charWidth(uniCode, fontnum);
+
+  tg->data  = 0;
+  tg->x     = x;
+  tg->width = advance;
+  tg->run   = 0;
+  tg->level = 0;
+
+  if (!advance) return 0;
+
+  if (fontnum == TFT_LOADED_FONT) {
+    const fontglyph *g = TFT_ST7735_findGlyph(loadedfont, uniCode);
+    uint8_t bpp = loadedfont->bpp ? loadedfont->bpp : 1;
+
+    tg->data  = loadedfont->bitmap + g->offset;
+    tg->width = g->width;
+    tg->dx    = g->xOffset;
+    tg->top   = g->yOffset;
+    tg->rows  = g->height;
+
+    // Rows above the line are skipped
+    while ((tg->top < 0) && tg->rows) {
+      tg->data = TFT_ST7735_decodeIndexedRow(tg->data, tg->width, bpp, 0, 0, 0);
+      tg->top++;
+      tg->rows--;
+    }
+  }
+#ifdef LOAD_GLCD
+  else if (fontnum == 1) {
+    tg->data = font + (uniCode * 5);
+  }
+#endif
+#ifdef LOAD_FONT2
+  else if (fontnum == 2) {
+    tg->data = chrtbl_f16[uniCode - 32];
+  }
+#endif
+#ifdef LOAD_RLE
+  else {
+    tg->data = ((const uint8_t * const *)fontdata[fontnum].chartbl)[uniCode - 32];
+  }
+#endif
+
+  return advance;
+}
+
+/***************************************************************************************
+** Function name:           textGlyphRow
+** Description:             Decode the next row of a text box character into levels
+***************************************************************************************/
+static void TFT_ST7735_textGlyphRow(textglyph *tg, uint8_t row, int font, uint8_t *level, int16_t maxWidth)
+{
+  int16_t i, px;
+
+  if (!tg->data) return;
+
+  if (font == TFT_LOADED_FONT) {
+    if ((row >= tg->top) && (row < tg->top + tg->rows)) {
+      tg->data = TFT_ST7735_decodeIndexedRow(tg->data, tg->width, loadedfont->bpp ? loadedfont->bpp : 1,
+                                             level, tg->x + tg->dx, maxWidth);
+    }
+    return;
+  }
+
+#ifdef LOAD_GLCD
+  if (font == 1) {
+    // Stored by columns, bit 0 is the top row
+    for (i = 0; i < 5; i++) {
+      px = tg->x + i;
+      if ((px >= 0) && (px < maxWidth) && (TFT_ST7735_PGM_READ_BYTE(tg->data + i) & (1 << row))) level[px] = 1;
+    }
+    return;
+  }
+#endif
+
+#ifdef LOAD_FONT2
+  if (font == 2) {
+    // Rows of whole bytes, MSB left
+    uint8_t bytes = (tg->width + 6) / 8;
+    for (i = 0; i < tg->width; i++) {
+      px = tg->x + i;
+      if ((px >= 0) && (px < maxWidth) && (TFT_ST7735_PGM_READ_BYTE(tg->data + (i >> 3)) & (0x80 >> (i & 7)))) level[px] = 1;
+    }
+    tg->data += bytes;
+    return;
+  }
+#endif
+
+  // RLE fonts: runs continue on the next row, so the run in progress is kept
+  for (i = 0; i < tg->width; i++) {
+    if (!tg->run) {
+      uint8_t line = TFT_ST7735_PGM_READ_BYTE(tg->data++);
+      tg->run   = (line & 0x7F) + 1;
+      tg->level = (line & 0x80) ? 1 : 0;
+    }
+    px = tg->x + i;
+    if (tg->level && (px >= 0) && (px < maxWidth)) level[px] = 1;
+    tg->run--;
+  }
+}
+
+/***************************************************************************************
+** Function name:           drawTextBox
+** Description:             Draw word wrapped text, each line is a single window
+***************************************************************************************/
+uint8_t TFT_ST7735_drawTextBox(TFT_ST7735_TextBox_T *box, char *text, uint8_t changedOnly)
+{
+  textglyph glyph[TFT_TEXTBOX_LINE_CHARS];
+  uint8_t   level[ST7735_TFTHEIGHT]; // One font row across the box
+  uint8_t   size = box->size;
+  int16_t   maxWidth = box->w / size;  // Box width in font pixels
+  int16_t   rows = TFT_ST7735_fontHeight(box->font) / textsize; // Font pixel rows
+  int16_t   lineHeight = rows * size + box->lineSpacing;
+  int16_t   ly = box->y;
+  uint8_t   line = 0, repainted = 0;
+
+  uint16_t fg = textcolor, bg = textbgcolor;
+  uint8_t  oldsize = textsize;
+
+  if (!box->painted) changedOnly = 0;
+
+  textcolor   = box->fgcolor;
+  textbgcolor = box->bgcolor;
+  textsize    = size;
+  TFT_ST7735_setRamp(((box->font == TFT_LOADED_FONT) && loadedfont && loadedfont->bpp) ? loadedfont->bpp : 1);
+
+  while ((lineHeight > 0) && (ly + lineHeight <= box->y + box->h)) {
+    char *start = text, *end, *s;
+    int16_t width = TFT_ST7735_wrapLine(&text, maxWidth, box->font, &end);
+    int16_t x = 0;
+    uint8_t count = 0, i, r, rep;
+    ptrdiff_t bytes = end - start;
+
+    // The same text in the same font and box is at the same position, so
+    // only the text is compared. A line of multibyte characters too long to
+    // keep is always repainted
+    if (line < TFT_TEXTBOX_LINES) {
+      if (changedOnly && (box->lineLength[line] == bytes) && !memcmp(box->lineText[line], start, bytes)) {
+        ly += lineHeight;
+        line++;
+        continue;
+      }
+      box->lineLength[line] = (bytes <= TFT_TEXTBOX_LINE_CHARS) ? (uint8_t)bytes : TFT_TEXTBOX_LINE_CHARS + 1;
+      if (bytes <= TFT_TEXTBOX_LINE_CHARS) memcpy(box->lineText[line], start, bytes);
+    }
+
+    if (box->align == TFT_ALIGN_CENTRE) x = (maxWidth - width) / 2;
+    if (box->align == TFT_ALIGN_RIGHT)  x = maxWidth - width;
+
+    for (s = start; s < end; ) {
+      unsigned int uniCode = TFT_ST7735_decodeUTF8(&s);
+      x += TFT_ST7735_startTextGlyph(&glyph[count++], uniCode, box->font, x);
+    }
+
+    // The line and the spacing below it are sent as one window, font row by
+    // font row, through the colour ramp and the line buffers
+    TFT_ST7735_setWindow(box->x, ly, box->x + box->w - 1, ly + lineHeight - 1);
+
+    uint8_t *buf = TFT_ST7735_getLineBuffer();
+    uint16_t n = 0;
+    int16_t px;
+
+    for (r = 0; r < rows; r++) {
+      for (px = 0; px < maxWidth; px++) level[px] = 0;
+      for (i = 0; i < count; i++) TFT_ST7735_textGlyphRow(&glyph[i], r, box->font, level, maxWidth);
+
+      for (rep = 0; rep < size; rep++) {
+        for (px = 0; px < box->w; px++) {
+          const uint8_t *color = ramp[(px / size < maxWidth) ? level[px / size] : 0];
+
+          buf[n++] = color[0];
+          buf[n++] = color[1];
+          if (n == sizeof(linebuf[0])) {
+            TFT_ST7735_Write_SPI(buf, n);
+            buf = TFT_ST7735_getLineBuffer();
+            n = 0;
+          }
+        }
+      }
+    }
+    if (n) TFT_ST7735_Write_SPI(buf, n);
+
+    if (box->lineSpacing) TFT_ST7735_writeColor(box->bgcolor, (uint32_t)box->lineSpacing * box->w);
+    TFT_ST7735_writeEnd();
+
+    ly += lineHeight;
+    line++;
+    repainted++;
+  }
+
+  // The strip below the last whole line only needs clearing once
+  if (!box->painted && (ly < box->y + box->h)) {
+    TFT_ST7735_fillRect(box->x, ly, box->w, box->y + box->h - ly, box->bgcolor);
+  }
+  box->painted = 1;
+
+  textcolor   = fg;
+  textbgcolor = bg;
+  textsize    = oldsize;
+
+  return repainted;
 }
 
 /***************************************************
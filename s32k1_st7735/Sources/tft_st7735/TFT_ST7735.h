@@ -92,6 +92,35 @@
 #define BC_DATUM (7) // Bottom centre
 #define BR_DATUM (8) // Bottom right
 
+//These select the transform applied by blitTransformed(), flags can be combined
+#define TFT_TRANSFORM_NONE    (0x0)
+#define TFT_TRANSFORM_FLIP_X  (0x1) // Mirror left to right
+#define TFT_TRANSFORM_FLIP_Y  (0x2) // Mirror top to bottom
+#define TFT_TRANSFORM_SWAP_XY (0x4) // Image rows become columns, applied before the flips
+#define TFT_TRANSFORM_ROT90   (TFT_TRANSFORM_SWAP_XY | TFT_TRANSFORM_FLIP_X) // Clockwise
+#define TFT_TRANSFORM_ROT180  (TFT_TRANSFORM_FLIP_X | TFT_TRANSFORM_FLIP_Y)
+#define TFT_TRANSFORM_ROT270  (TFT_TRANSFORM_SWAP_XY | TFT_TRANSFORM_FLIP_Y)
+
+// Font number used to draw with the font given to TFT_ST7735_loadFont()
+#define TFT_LOADED_FONT (9)
+
+// Maximum characters of a numeric field, sign and decimal point included
+#define TFT_NUMFIELD_CHARS (12)
+
+// Lines of a text box whose content is remembered, lines below are always repainted
+#define TFT_TEXTBOX_LINES (12)
+
+// Maximum characters on one line of a text box, longer lines are broken
+#define TFT_TEXTBOX_LINE_CHARS (32)
+
+// Maximum digits of a seven segment display
+#define TFT_SEVENSEG_DIGITS (8)
+
+// Text box line alignment
+#define TFT_ALIGN_LEFT   (0)
+#define TFT_ALIGN_CENTRE (1)
+#define TFT_ALIGN_RIGHT  (2)
+
 
 // Change the width and height if required (defined in portrait mode)
 // or use the constructor to over-ride defaults
@@ -217,6 +246,80 @@ typedef struct {
     unsigned       char height;
 } fontinfo;
 
+// Fonts made by the font compiler (tools/fontconv.py) use an indexed format.
+// Each glyph has its own bounding box inside the character cell, which is
+// advance pixels wide and the font height tall. The bitmap of a glyph is Run
+// Length Encoded row by row and runs never continue on the next row.
+// 1 bpp: bit 7 set is a run of (n & 0x7F) + 1 foreground pixels, else a run
+// of n + 1 background pixels.
+// 2 and 4 bpp (anti-aliased): 00nnnnnn is a run of n + 1 background pixels,
+// 01nnnnnn a run of n + 1 foreground pixels and 1nnnnnnn is followed by the
+// levels of n + 1 pixels packed MSB first, 0 being the background.
+// Fonts with gaps in their character set list the code of every glyph in
+// codes, in ascending order, and are searched with a binary search.
+typedef struct {
+    uint32_t offset;   // Index of the first RLE byte of the glyph in bitmap
+    uint8_t  width;    // Bounding box size, 0 for blank glyphs
+    uint8_t  height;
+    uint8_t  advance;  // Cursor movement
+    int8_t   xOffset;  // Bounding box position from the top left of the cell
+    int8_t   yOffset;
+} fontglyph;
+
+typedef struct {
+    const uint8_t   *bitmap;
+    const fontglyph *glyph;    // One entry for each character in codes, or from first to last
+    const uint16_t  *codes;    // Sorted character codes of the glyphs, 0 if there are no gaps
+    uint16_t         first;
+    uint16_t         last;
+    uint16_t         count;    // Number of glyphs
+    uint8_t          height;   // Line height
+    uint8_t          baseline; // Baseline position from the top of the line
+    uint8_t          bpp;      // Bits per pixel: 1 (or 0), 2 or 4
+} fontindexed;
+
+// Numeric readout with a fixed format, see TFT_ST7735_initNumField(). It needs
+// a background colour to erase the characters that change, with transparent
+// text (same foreground and background) the old characters stay on screen
+typedef struct TFT_ST7735_NumField_Tag
+{
+    int16_t  x, y;         // Top left of the field
+    uint8_t  chars;        // Characters in the field, sign and decimal point included
+    uint8_t  decimals;     // Digits after the decimal point
+    uint8_t  font, size;
+    uint16_t fgcolor, bgcolor;
+    int16_t  cellWidth;    // Pixel width of a digit cell
+    int16_t  pointWidth;   // Pixel width of the decimal point cell
+    int16_t  height;
+    char     shown[TFT_NUMFIELD_CHARS + 1]; // Characters on screen
+} TFT_ST7735_NumField_T;
+
+// Seven segment readout in the style of Font 7, see TFT_ST7735_initSevenSeg()
+typedef struct TFT_ST7735_SevenSeg_Tag
+{
+    int16_t  x, y;         // Top left of the display
+    uint8_t  digits;       // Digit cells, a minus sign takes one
+    uint8_t  decimals;     // Digits after the decimal point
+    uint8_t  size;
+    uint16_t oncolor, bgcolor;
+    uint16_t offcolor;     // Unlit segments, the background unless changed after init
+    uint8_t  shown[TFT_SEVENSEG_DIGITS]; // Lit segments on screen, bit 0 = A ... bit 6 = G
+    uint8_t  painted;      // Set once the whole display has been drawn
+} TFT_ST7735_SevenSeg_T;
+
+// Word wrapped text in a rectangle, see TFT_ST7735_initTextBox()
+typedef struct TFT_ST7735_TextBox_Tag
+{
+    int16_t  x, y, w, h;
+    uint8_t  font, size;
+    uint8_t  align;        // TFT_ALIGN_LEFT, TFT_ALIGN_CENTRE or TFT_ALIGN_RIGHT
+    uint8_t  lineSpacing;  // Background pixels between lines
+    uint16_t fgcolor, bgcolor;
+    uint8_t  painted;      // Set once the whole box has been drawn
+    char     lineText[TFT_TEXTBOX_LINES][TFT_TEXTBOX_LINE_CHARS]; // Bytes of the lines on screen
+    uint8_t  lineLength[TFT_TEXTBOX_LINES]; // Bytes in lineText, above TFT_TEXTBOX_LINE_CHARS if not kept
+} TFT_ST7735_TextBox_T;
+
 typedef enum TFT_ST7735_Result_Tag
 {
     RESULT_FAILURE,
@@ -300,6 +403,13 @@ void TFT_ST7735_Set_Reset(TFT_ST7735_Reset_T status);
  */
 void TFT_ST7735_Write_SPI(unsigned char *data, uint32_t size);
 
+/**
+ * Block until every byte handed to TFT_ST7735_Write_SPI has been shifted out
+ * @attention Pixel bursts are sent from RAM buffers without waiting, so this
+ * is called before CS or DC are changed after a burst.
+ */
+void TFT_ST7735_Wait_SPI(void);
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// CALLOUTS END HERE
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -362,6 +472,10 @@ void TFT_ST7735_fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int
 
 void TFT_ST7735_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);
 
+void TFT_ST7735_drawBitmap_bgcolor(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+
+void TFT_ST7735_blitTransformed(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h, uint8_t transform);
+
 void TFT_ST7735_setCursor(int16_t x, int16_t y);
 
 void TFT_ST7735_setCursor_font(int16_t x, int16_t y, uint8_t font);
@@ -412,6 +526,30 @@ int16_t TFT_ST7735_textWidth(char *string, int font);
 
 int16_t TFT_ST7735_fontHeight(int font);
 
+void TFT_ST7735_loadFont(const fontindexed *font);
+
+#ifdef TFT_ST7735_METRICS_CACHE_ENTRIES
+void TFT_ST7735_metricsCacheFlush(void);
+#endif
+
+void TFT_ST7735_initNumField(TFT_ST7735_NumField_T *field, int16_t x, int16_t y, uint8_t chars, uint8_t decimals, uint8_t font, uint8_t datum);
+
+uint8_t TFT_ST7735_drawNumField(TFT_ST7735_NumField_T *field, int32_t value);
+
+void TFT_ST7735_initSevenSeg(TFT_ST7735_SevenSeg_T *display, int16_t x, int16_t y, uint8_t digits, uint8_t decimals, uint8_t datum);
+
+uint8_t TFT_ST7735_drawSevenSeg(TFT_ST7735_SevenSeg_T *display, int32_t value);
+
+void TFT_ST7735_initTextBox(TFT_ST7735_TextBox_T *box, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t font, uint8_t align, uint8_t lineSpacing);
+
+uint8_t TFT_ST7735_drawTextBox(TFT_ST7735_TextBox_T *box, char *text, uint8_t changedOnly);
+
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+void TFT_ST7735_glyphCacheFlush(void);
+
+void TFT_ST7735_glyphCacheStats(uint32_t *hits, uint32_t *misses);
+#endif
+
 /***************************************************
 
   ORIGINAL LIBRARY HEADER
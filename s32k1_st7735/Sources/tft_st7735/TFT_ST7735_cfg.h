@@ -95,4 +95,36 @@
 
 //#define CLIP_CHECK
 
+// Uncomment the following #define to fix the rotation (0-3) at build time.
+// The panel geometry, column/row offsets and tab colour then become constants,
+// clipping bounds fold into immediates and the init tables of other panels are
+// dropped. setRotation() always applies this rotation.
+
+//#define TFT_ST7735_FIXED_ROTATION (1)
+
+// Pixels for block writes (bitmaps, glyphs...) are expanded into a line buffer
+// and sent with a single SPI transfer per chunk. Two buffers of this many pixels
+// are kept in RAM so one can be filled while the other is being sent.
+
+#define TFT_ST7735_LINE_BUFFER_PIXELS (32)
+
+// Uncomment TFT_ST7735_GLYPH_CACHE_BYTES to keep recently drawn characters expanded
+// to RGB565 in a RAM arena of that many bytes. Entries are keyed by font, character,
+// colours and text size and are replaced least recently used first. A cached
+// character is sent with a single SPI transfer straight from the arena, which suits
+// numeric readouts that are redrawn several times a second. Only text drawn with a
+// background colour is cached. A font 4 digit needs about 730 bytes, a font 7 digit
+// about 2800 bytes.
+
+//#define TFT_ST7735_GLYPH_CACHE_BYTES   (4096)
+#define TFT_ST7735_GLYPH_CACHE_ENTRIES (24)
+
+// Uncomment TFT_ST7735_METRICS_CACHE_ENTRIES to remember the pixel width of that many
+// strings drawn with a text datum or padding, keyed by string address and font, so
+// aligned labels are drawn with a single pass over the string. Strings are assumed
+// not to change at the same address: call TFT_ST7735_metricsCacheFlush() after
+// rewriting a buffer that was drawn. drawNumber() and drawFloat() never use it.
+
+//#define TFT_ST7735_METRICS_CACHE_ENTRIES (8)
+
 #endif /* #ifndef TST_ST7735_CFG_H */
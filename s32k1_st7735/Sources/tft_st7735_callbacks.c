@@ -166,3 +166,17 @@ void TFT_ST7735_Write_SPI(unsigned char *data, uint32_t size)
 
     LPSPI_DRV_MasterTransfer(LPSPICOM1, (const uint8_t *)data, (uint8_t*)0, size);
 }
+
+/**
+ * Block until every byte handed to TFT_ST7735_Write_SPI has been shifted out
+ */
+void TFT_ST7735_Wait_SPI(void)
+{
+    uint32_t remainingBytes = 0;
+
+    do
+    {
+        LPSPI_DRV_MasterGetTransferStatus(LPSPICOM1, &remainingBytes);
+    }
+    while (remainingBytes != 0);
+}
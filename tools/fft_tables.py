@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+"""
+Table generator for the FFT example (s32k1_st7735/Sources/fft_app.c).
+
+Writes fft_tables.c and fft_tables.h with the constant tables used by the
+transform for a given number of points, so they live in flash and nothing
+is computed with trig functions at run time:
+
+    FFT_TwiddleTable    e^(-2*pi*i*k/N) for k = 0 .. N/2 - 1 as float pairs
+    FFT_TwiddleTableQ15 the same in Q15, real part in the low half word
+    FFT_BitReverseTable index pairs to swap for the bit reversal of N points
+    FFT_BitReverseTableHalf the same for N/2 points (real input transform)
+    FFT_WindowTable     the first N/2 coefficients of each generated window,
+                        the second half mirrors the first (symmetric windows)
+    FFT_WindowTableQ15  the same in Q15
+    FFT_WindowRow       row of each window in the two tables above
+    FFT_WindowGains     coherent gain, power gain and equivalent noise
+                        bandwidth of each window
+
+Windows, in the order of the FFT_WINDOW_* indexes:
+
+    Hann, Hamming, 4 term Blackman-Harris, flat top (5 terms, as
+    flattopwin in Matlab) and Kaiser (beta from --kaiser-beta)
+
+Each window costs 2 * N bytes of float and N bytes of Q15 coefficients, so
+only the ones in --windows are generated. FFT_WINDOWS in fft_tables.h is
+their mask, bit FFT_WINDOW_* set for each one; fft_app.c stops the build
+when FFT_DEFAULT_WINDOW is not in it and FFT_SetWindow rejects the others.
+
+Smaller transforms use every 2nd, 4th... entry of the same table. Tables
+the build configuration does not use are dropped by --gc-sections.
+
+It also prints the static RAM that fft_app.c needs for n points in each
+configuration, to compare with FFT_RAM_BUDGET_BYTES in fft_app_cfg.h.
+
+Usage:
+
+    fft_tables.py -n 2048 --windows hamming -o ../s32k1_st7735/Sources
+    fft_tables.py -n 2048 --windows hann,kaiser --kaiser-beta 6 -o ../s32k1_st7735/Sources
+    fft_tables.py -n 2048 --windows all -o ../s32k1_st7735/Sources
+
+The number of points must match FFT_SAMPLE_MAX in fft_app.c, the build
+stops with an #error otherwise.
+"""
+
+import argparse
+import math
+import os
+import sys
+
+
+def c_list(values, indent='    ', per_line=4):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join(values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def f32(v):
+    # Nine significant digits round trip a float exactly
+    s = '%.9g' % v
+    if s in ('-0', '0'):
+        s = '0.0'
+    elif 'e' not in s and '.' not in s:
+        s += '.0'
+    return s + 'f'
+
+
+def q15(v):
+    # Rounded and saturated, as an unsigned 16 bit pattern
+    return max(-32768, min(32767, int(round(v * 32768.0)))) & 0xFFFF
+
+
+def cosine_sum(n, coefficients):
+    # a0 - a1 cos(2 pi k / (n - 1)) + a2 cos(4 pi k / (n - 1)) - ...
+    return [sum((-1) ** i * a * math.cos(2.0 * math.pi * i * k / (n - 1)) for i, a in enumerate(coefficients))
+            for k in range(n)]
+
+
+def bessel_i0(x):
+    # Power series of the modified Bessel function of the first kind, order 0
+    total = term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def kaiser(n, beta):
+    return [bessel_i0(beta * math.sqrt(1.0 - (2.0 * k / (n - 1) - 1.0) ** 2)) / bessel_i0(beta) for k in range(n)]
+
+
+def windows(n, beta):
+    # Name of the FFT_WINDOW_* index, description and the n coefficients
+    return [
+        ('HANN', 'Hann', cosine_sum(n, [0.5, 0.5])),
+        ('HAMMING', 'Hamming', cosine_sum(n, [0.54, 0.46])),
+        ('BLACKMAN_HARRIS', '4 term Blackman-Harris', cosine_sum(n, [0.35875, 0.48829, 0.14128, 0.01168])),
+        ('FLAT_TOP', 'Flat top', cosine_sum(n, [0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368])),
+        ('KAISER', 'Kaiser, beta %g' % beta, kaiser(n, beta)),
+    ]
+
+
+def bit_reverse_swaps(n):
+    bits = n.bit_length() - 1
+    swaps = []
+    for i in range(n):
+        j = int(format(i, '0%db' % bits)[::-1], 2)
+        if i < j:
+            swaps.append('{ %d, %d }' % (i, j))
+    return swaps
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Generate the constant tables of the FFT example')
+    ap.add_argument('-n', '--points', type=int, default=2048, help='transform size, a power of two')
+    ap.add_argument('-o', '--outdir', default='.', help='directory for fft_tables.c and fft_tables.h')
+    ap.add_argument('--kaiser-beta', type=float, default=9.0, help='beta of the Kaiser window')
+    ap.add_argument('--windows', default='all',
+                    help='comma separated windows to generate: hann, hamming, blackman_harris, flat_top, '
+                         'kaiser or all')
+    args = ap.parse_args()
+
+    n = args.points
+    if n < 4 or n & (n - 1):
+        sys.exit('the number of points must be a power of two, at least 4')
+    power = n.bit_length() - 1
+
+    twiddles = []
+    twiddles_q15 = []
+    for k in range(n // 2):
+        a = 2.0 * math.pi * k / n
+        twiddles.append('{ %s, %s }' % (f32(math.cos(a)), f32(-math.sin(a))))
+        twiddles_q15.append('0x%08XU' % ((q15(-math.sin(a)) << 16) | q15(math.cos(a))))
+
+    swaps = bit_reverse_swaps(n)
+    swaps_half = bit_reverse_swaps(n // 2)
+
+    window_list = windows(n, args.kaiser_beta)
+    names = [name for name, description, w in window_list]
+    wanted = names if args.windows == 'all' else [w.strip().upper() for w in args.windows.split(',')]
+    for name in wanted:
+        if name not in names:
+            sys.exit('unknown window %s, use %s or all' % (name.lower(), ', '.join(x.lower() for x in names)))
+    mask = sum(1 << i for i, name in enumerate(names) if name in wanted)
+    rows = []
+    window_tables = []
+    window_tables_q15 = []
+    window_gains = []
+    for name, description, w in window_list:
+        coherent = sum(w) / n
+        power_gain = sum(v * v for v in w) / n
+        window_gains.append('    { %s, %s, %s }, /* %s */'
+                            % (f32(coherent), f32(power_gain), f32(power_gain / (coherent * coherent)), description))
+        if name not in wanted:
+            rows.append('%dU' % len(wanted))
+            continue
+        rows.append('%dU' % len(window_tables))
+        half = w[:n // 2]
+        window_tables.append('    /* %s */\n    {\n%s\n    },' % (description, c_list([f32(v) for v in half], indent='        ')))
+        window_tables_q15.append('    /* %s */\n    {\n%s\n    },'
+                                 % (description, c_list(['%d' % max(-32768, min(32767, int(round(v * 32767.0))))
+                                                         for v in half], indent='        ', per_line=16)))
+    command = '-n %d --windows %s' % (n, ','.join(name.lower() for name in names if name in wanted))
+
+    with open(os.path.join(args.outdir, 'fft_tables.h'), 'w') as f:
+        f.write('/* Generated by tools/fft_tables.py %s, do not edit */\n\n' % command)
+        f.write('#ifndef FFT_TABLES_H\n#define FFT_TABLES_H\n\n')
+        f.write('#include <stdint.h>\n\n')
+        f.write('#define FFT_TABLE_SIZE                                  (%dU)\n' % n)
+        f.write('#define FFT_TABLE_POWER_OF_TWO                          (%dU)\n' % power)
+        f.write('#define FFT_BIT_REVERSE_SWAPS                           (%dU)\n' % len(swaps))
+        f.write('#define FFT_BIT_REVERSE_HALF_SWAPS                      (%dU)\n\n' % len(swaps_half))
+        for i, (name, description, w) in enumerate(window_list):
+            f.write('#define FFT_WINDOW_%-37s(%dU)\n' % (name, i))
+        f.write('#define FFT_WINDOW_COUNT                                (%dU)\n\n' % len(window_list))
+        f.write('/* Windows in FFT_WindowTable, bit FFT_WINDOW_* set for each one */\n')
+        f.write('#define FFT_WINDOWS                                     (0x%02XU)\n' % mask)
+        f.write('#define FFT_WINDOW_ROWS                                 (%dU)\n\n' % len(wanted))
+        f.write('typedef struct FFT_Complex_Tag\n{\n    float re;\n    float im;\n} FFT_Complex_T;\n\n')
+        f.write('typedef struct FFT_WindowGain_Tag\n{\n'
+                '    float coherent;     /* Mean of the window, the amplitude of a tone at a bin centre is scaled by this */\n'
+                '    float power;        /* Mean of the squared window, the power of a tone or noise is scaled by this */\n'
+                '    float enbw;         /* Equivalent noise bandwidth in bins, power / coherent^2 */\n'
+                '} FFT_WindowGain_T;\n\n')
+        f.write('/* e^(-2*pi*i*k/FFT_TABLE_SIZE) for k = 0 .. FFT_TABLE_SIZE/2 - 1 */\n')
+        f.write('extern const FFT_Complex_T FFT_TwiddleTable[FFT_TABLE_SIZE / 2];\n\n')
+        f.write('/* The same in Q15, real part in bits 0-15 and imaginary part in bits 16-31 */\n')
+        f.write('extern const uint32_t FFT_TwiddleTableQ15[FFT_TABLE_SIZE / 2];\n\n')
+        f.write('/* Index pairs i < j to swap for the bit reversal of FFT_TABLE_SIZE points */\n')
+        f.write('extern const uint16_t FFT_BitReverseTable[FFT_BIT_REVERSE_SWAPS][2];\n\n')
+        f.write('/* The same for FFT_TABLE_SIZE / 2 points */\n')
+        f.write('extern const uint16_t FFT_BitReverseTableHalf[FFT_BIT_REVERSE_HALF_SWAPS][2];\n\n')
+        f.write('/* Coefficients 0 .. FFT_TABLE_SIZE/2 - 1 of each window in FFT_WINDOWS,\n'
+                ' * coefficient FFT_TABLE_SIZE - 1 - k equals coefficient k */\n')
+        f.write('extern const float FFT_WindowTable[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2];\n\n')
+        f.write('/* The same in Q15 */\n')
+        f.write('extern const int16_t FFT_WindowTableQ15[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2];\n\n')
+        f.write('/* Row of each FFT_WINDOW_* in the window tables, FFT_WINDOW_ROWS if not generated */\n')
+        f.write('extern const uint8_t FFT_WindowRow[FFT_WINDOW_COUNT];\n\n')
+        f.write('/* Gains of each window over all FFT_TABLE_SIZE coefficients */\n')
+        f.write('extern const FFT_WindowGain_T FFT_WindowGains[FFT_WINDOW_COUNT];\n\n')
+        f.write('#endif /* FFT_TABLES_H */\n')
+
+    with open(os.path.join(args.outdir, 'fft_tables.c'), 'w') as f:
+        f.write('/* Generated by tools/fft_tables.py %s, do not edit */\n\n' % command)
+        f.write('#include "fft_tables.h"\n\n')
+        f.write('const FFT_Complex_T FFT_TwiddleTable[FFT_TABLE_SIZE / 2] =\n{\n%s\n};\n'
+                % c_list(twiddles))
+        f.write('\nconst uint32_t FFT_TwiddleTableQ15[FFT_TABLE_SIZE / 2] =\n{\n%s\n};\n'
+                % c_list(twiddles_q15, per_line=8))
+        f.write('\nconst uint16_t FFT_BitReverseTable[FFT_BIT_REVERSE_SWAPS][2] =\n{\n%s\n};\n'
+                % c_list(swaps, per_line=8))
+        f.write('\nconst uint16_t FFT_BitReverseTableHalf[FFT_BIT_REVERSE_HALF_SWAPS][2] =\n{\n%s\n};\n'
+                % c_list(swaps_half, per_line=8))
+        f.write('\nconst float FFT_WindowTable[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2] =\n{\n%s\n};\n'
+                % '\n'.join(window_tables))
+        f.write('\nconst int16_t FFT_WindowTableQ15[FFT_WINDOW_ROWS][FFT_TABLE_SIZE / 2] =\n{\n%s\n};\n'
+                % '\n'.join(window_tables_q15))
+        f.write('\nconst uint8_t FFT_WindowRow[FFT_WINDOW_COUNT] =\n{\n    %s\n};\n' % ', '.join(rows))
+        f.write('\nconst FFT_WindowGain_T FFT_WindowGains[FFT_WINDOW_COUNT] =\n{\n%s\n};\n'
+                % '\n'.join(window_gains))
+
+    print('fft_tables: %d points, %d bytes of float and %d bytes of Q15 twiddles, %d bytes of bit reversal swaps, '
+          '%d bytes of float and %d bytes of Q15 windows'
+          % (n, len(twiddles) * 8, len(twiddles_q15) * 4, (len(swaps) + len(swaps_half)) * 4,
+             len(wanted) * (n // 2) * 4, len(wanted) * (n // 2) * 2))
+
+    # What the RAM build loads into its 31KB m_text besides the code
+    print('Constants of the float / Q15 FFT: %d / %d bytes'
+          % (len(twiddles) * 8 + (len(swaps) + len(swaps_half)) * 4 + len(wanted) * (n // 2) * 4,
+             len(twiddles_q15) * 4 + (len(swaps) + len(swaps_half)) * 4 + len(wanted) * (n // 2) * 2))
+
+    # Static RAM of fft_app.c for FFT_RAM_BUDGET_BYTES: DSP scratch (FFT_Arena),
+    # acquisition ring of 2 or 3 frames and the bin to band tables
+    ring = [buffers * n * 2 for buffers in (2, 3)]
+    bins = (n // 2 + 1) * 5
+    print('RAM per configuration (DSP scratch + ring of 2 / 3 frames + band tables):')
+    for name, scratch in (('float, real input', 2 * (n // 2 + 1) * 4), ('float, complex', 2 * n * 4),
+                          ('Q15, real input', (n // 2 + 1) * 4), ('Q15, complex', n * 4)):
+        print('    %-18s %6d + %d / %d + %d = %d / %d bytes'
+              % (name, scratch, ring[0], ring[1], bins, scratch + ring[0] + bins, scratch + ring[1] + bins))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,1142 @@
+/***************************************************
+  DESCRIPTION
+
+  Host test of the FFT example (s32k1_st7735/Sources/fft_app.c).
+
+  It includes fft_app.c, so the static transforms are tested exactly as
+  they are built for the S32K144, and runs on a PC:
+
+    accuracy  the spectrum of test signals against a double precision DFT
+              of the same windowed samples, and the band levels of
+              FFT_GetFrequencyResponse against the bands of that DFT
+    bench     host time per frame of the window and transform, and of
+              FFT_GetFrequencyResponse, then the CPU load of 20s of audio:
+              the time in FFT_GetSample (the ADC interrupt) and in the
+              main loop FFT_GetFrequencyResponse per second of audio, the
+              figure to compare with the FFT_GOERTZEL filter bank
+    snr       the spectrum against one saved by another build, to measure
+              the SNR of the Q15 path against the float path
+    kernels   the bit reversal, radix-2 or radix-4 FFT, its inverse and the
+              real input split of every size up to FFT_TABLE_SIZE against
+              the permutation and a double precision DFT of random data
+    bands     the level every band reads for a 0.5V tone at 60Hz and at
+              the centre of each band: the level of its own band and the
+              rejection of the others
+
+  Build and run it from the repository root, for the configuration in
+  fft_app_cfg.h:
+
+    S=s32k1_st7735/Sources
+    cc -std=c99 -O2 -Itools/host -I$S -o fft_test tools/fft_test.c \
+        $S/fft_tables.c $S/tft_st7735/TFT_ST7735.c \
+        $S/tft_st7735/TFT_ST7735_fontinfo.c $S/tft_st7735/fonts/[A-Za-z]*.c -lm
+    ./fft_test accuracy
+    ./fft_test kernels
+
+  Add -DFFT_FIXED_POINT for the Q15 path, -DFFT_TEST_COMPLEX for the full
+  complex FFT (FFT_REAL_INPUT off) or -DFFT_TEST_RADIX2 for the radix-2
+  kernel (FFT_RADIX4 off). With -DFFT_GOERTZEL only the bands test and
+  the load of the bench are built. -DFFT_FREQ_BANDS=16U or 32U changes
+  the number of bands, for the load of either path at 8, 16 and 32 bands.
+  The exit status is 1 when a result is out of its tolerance.
+
+  For the SNR of the Q15 path, save the spectra of the float build and
+  compare them with the Q15 build, of the test signals or of a recording
+  (raw 16 bit little endian ADC codes, FFT_SAMPLE_MAX per frame):
+
+    ./fft_test snr save float.bin [recording.raw]
+    ./fft_test_q15 snr compare float.bin [recording.raw]
+
+  The bench times the PC, not the Cortex-M4. Cycle counts need the board:
+  main.c drives PTD0 high while a frame is analysed, for a scope or a
+  logic analyser.
+
+  Use at your own risk.
+
+ ****************************************************/
+
+//////////////////////////////////////////////////////////////////////
+/// Include files
+//////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fft_app_cfg.h"
+
+/* The PC has the RAM of any configuration */
+#undef FFT_RAM_BUDGET_BYTES
+#define FFT_RAM_BUDGET_BYTES                            (0xFFFFFFFFU)
+
+#ifdef FFT_TEST_COMPLEX
+#undef FFT_REAL_INPUT
+#endif
+#ifdef FFT_TEST_RADIX2
+#undef FFT_RADIX4
+#endif
+
+#include "fft_app.c"
+
+//////////////////////////////////////////////////////////////////////
+/// Defines
+//////////////////////////////////////////////////////////////////////
+
+#define FFT_TEST_PI                                     (3.14159265358979323846)
+#define FFT_TEST_SIGNALS                                (5U)
+#define FFT_TEST_CODES_PER_VOLT                         (FFT_ADC_MAX / FFT_ADC_REFERENCE)
+
+/* Bands more than this below the strongest one are not compared, in Q15
+ * they are down at the noise floor of the transform */
+#define FFT_TEST_BAND_RANGE_DB                          (40.0)
+
+/* Tolerances of the spectrum against the DFT and of the band levels */
+#ifdef FFT_FIXED_POINT
+#define FFT_TEST_MIN_SNR_DB                             (40.0)
+#define FFT_TEST_MAX_BAND_ERROR_DB                      (0.25)
+#define FFT_TEST_MIN_KERNEL_SNR_DB                      (50.0)
+#else
+#define FFT_TEST_MIN_SNR_DB                             (110.0)
+#define FFT_TEST_MAX_BAND_ERROR_DB                      (0.001)
+#define FFT_TEST_MIN_KERNEL_SNR_DB                      (120.0)
+#endif
+
+#define FFT_TEST_BENCH_FRAMES                           (2000U)
+
+/* Audio fed to FFT_GetSample for the load, one second (at 50us) replayed */
+#define FFT_TEST_LOAD_SECONDS                           (20U)
+#define FFT_TEST_LOAD_SAMPLES                           (20000U)
+
+/* Tone of the bands test, the top of the bars, and how far its own band
+ * may read from it when the tone is at the band centre */
+#define FFT_TEST_TONE_V                                 (0.5)
+#define FFT_TEST_MAX_CENTRE_ERROR_DB                    (1.0)
+#define FFT_TEST_MAINS_HZ                               (60.0)
+
+//////////////////////////////////////////////////////////////////////
+/// Variables
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FFT_GOERTZEL
+static const char* const FFT_TestSignalNames[FFT_TEST_SIGNALS] =
+{
+    "1kHz 0.5V",
+    "440Hz 2.4V",
+    "1kHz 10mV + 5kHz 5mV",
+    "white noise 1V",
+    "chirp 100Hz to 8kHz 1V",
+};
+
+static uint16_t FFT_testSamples[FFT_SAMPLE_MAX];
+static double FFT_testCos[FFT_SAMPLE_MAX];
+static double FFT_testRe[FFT_FREQUENCY_RESP_SIZE];
+static double FFT_testIm[FFT_FREQUENCY_RESP_SIZE];
+static double FFT_refRe[FFT_FREQUENCY_RESP_SIZE];
+static double FFT_refIm[FFT_FREQUENCY_RESP_SIZE];
+static uint32_t FFT_testSeed = 1;
+
+/* Kernel test data, any size up to FFT_SAMPLE_MAX */
+static double FFT_kernelInRe[FFT_SAMPLE_MAX];
+static double FFT_kernelInIm[FFT_SAMPLE_MAX];
+static double FFT_kernelRefRe[FFT_SAMPLE_MAX];
+static double FFT_kernelRefIm[FFT_SAMPLE_MAX];
+static double FFT_kernelOutRe[FFT_SAMPLE_MAX];
+static double FFT_kernelOutIm[FFT_SAMPLE_MAX];
+#ifdef FFT_FIXED_POINT
+static uint32_t FFT_kernelData[FFT_SAMPLE_MAX + 1];
+#else
+static float FFT_kernelRe[FFT_SAMPLE_MAX + 1];
+static float FFT_kernelIm[FFT_SAMPLE_MAX + 1];
+#endif
+#endif /* !FFT_GOERTZEL */
+
+//////////////////////////////////////////////////////////////////////
+/// Function prototypes
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * Feed a tone of FFT_TEST_TONE_V to FFT_GetSample for a few frames and get
+ * the bands of the last one
+ * @param frequencyHz
+ * @param freqResponsePerBand - FFT_FREQ_BANDS levels in volts
+ */
+static void FFT_TestToneBands(double frequencyHz, float* freqResponsePerBand);
+
+/**
+ * Print the bands for tones at FFT_TEST_MAINS_HZ and at each band centre
+ * @return 0 if every band reads its centre tone within FFT_TEST_MAX_CENTRE_ERROR_DB
+ */
+static int FFT_TestBandRejection(void);
+
+/**
+ * Feed FFT_TEST_LOAD_SECONDS of audio to FFT_GetSample, get the bands of
+ * every frame and print the host time of each per second of audio
+ * @return 0
+ */
+static int FFT_TestLoad(void);
+
+#ifndef FFT_GOERTZEL
+/**
+ * Uniform pseudo random number, the same sequence on every host
+ * @return -1.0 to 1.0
+ */
+static double FFT_TestRandom(void);
+
+/**
+ * Fill FFT_testSamples with ADC codes of a test signal
+ * @param signal - index in FFT_TestSignalNames
+ */
+static void FFT_TestSignal(uint32_t signal);
+
+/**
+ * Spectrum of FFT_testSamples by a double precision DFT, bins 0 to
+ * FFT_SAMPLE_MAX / 2 as X[k] / FFT_SAMPLE_MAX in volts
+ */
+static void FFT_TestReference(double* re, double* im);
+
+/**
+ * Spectrum of FFT_testSamples by the transform of the build, scaled the
+ * same way as FFT_TestReference
+ */
+static void FFT_TestSpectrum(double* re, double* im);
+
+/**
+ * Feed FFT_testSamples to FFT_GetSample as one frame and get its bands
+ * @param freqResponsePerBand - FFT_FREQ_BANDS levels in volts
+ */
+static void FFT_TestBands(float* freqResponsePerBand);
+
+/**
+ * Band levels of the spectrum from FFT_TestReference
+ * @param freqResponsePerBand - FFT_FREQ_BANDS levels in volts
+ */
+static void FFT_TestReferenceBands(const double* re, const double* im, float* freqResponsePerBand);
+
+/**
+ * Compare the spectrum and the bands of every test signal with the DFT
+ * @return 0 if all are within tolerance
+ */
+static int FFT_TestAccuracy(void);
+
+/**
+ * Time the window and transform, and FFT_GetFrequencyResponse
+ * @return 0
+ */
+static int FFT_TestBench(void);
+
+/**
+ * SNR of a spectrum against a reference one, over bins 0 to FFT_SAMPLE_MAX / 2
+ * @param worst - returns the largest bin error relative to the strongest
+ *                bin of the reference, in dB
+ * @return SNR in dB
+ */
+static double FFT_TestSnr(const double* re, const double* im, const double* refRe, const double* refIm,
+                          double* worst);
+
+/**
+ * Load the next frame into FFT_testSamples, a test signal or a frame of a
+ * recording
+ * @param frame - frame index
+ * @param recording - raw 16 bit little endian ADC codes, 0 for the test signals
+ * @return 1 if loaded, 0 after the last frame
+ */
+static int FFT_TestLoadFrame(uint32_t frame, FILE* recording);
+
+/**
+ * Save the spectra of all frames, or compare them with saved ones
+ * @param save - 1 to save them to spectra, 0 to compare
+ * @param spectra - file name of the saved spectra
+ * @param recording - file name of a recording, 0 for the test signals
+ * @return 0 if done, 1 on a file error
+ */
+static int FFT_TestSnrAgainst(int save, const char* spectra, const char* recording);
+
+/**
+ * Double precision DFT of n points, n a power of two up to FFT_SAMPLE_MAX
+ */
+static void FFT_TestDft(uint32_t n, const double* inRe, const double* inIm, double* outRe, double* outIm);
+
+/**
+ * SNR of n complex values against reference ones
+ * @return SNR in dB
+ */
+static double FFT_TestKernelSnr(uint32_t n, const double* re, const double* im, const double* refRe,
+                                const double* refIm);
+
+/**
+ * Print one kernel result and check it against FFT_TEST_MIN_KERNEL_SNR_DB
+ * @return 1 if below
+ */
+static int FFT_TestKernelResult(const char* kernel, long m, double snr);
+
+/**
+ * Check the bit reversal, the FFT, its inverse and the real input split
+ * of every size against the permutation and FFT_TestDft
+ * @return 0 if all pass
+ */
+static int FFT_TestKernels(void);
+#endif /* !FFT_GOERTZEL */
+
+int main(int argc, char** argv);
+
+//////////////////////////////////////////////////////////////////////
+/// Function definitions
+//////////////////////////////////////////////////////////////////////
+
+/* The display is not used, FFT_PlotFrequencyResponse only has to link */
+void TFT_ST7735_Configure_SPI(void) {}
+void TFT_ST7735_Delay(unsigned int ms) { (void)ms; }
+void TFT_ST7735_Set_Chip_Select(TFT_ST7735_CS_T status) { (void)status; }
+void TFT_ST7735_Set_Data_Command(TFT_ST7735_Data_Command_T request) { (void)request; }
+void TFT_ST7735_Set_Reset(TFT_ST7735_Reset_T status) { (void)status; }
+void TFT_ST7735_Write_SPI(unsigned char *data, uint32_t size) { (void)data; (void)size; }
+void TFT_ST7735_Wait_SPI(void) {}
+
+static void FFT_TestToneBands(double frequencyHz, float* freqResponsePerBand)
+{
+    FFT_Initialize();
+
+    for (uint32_t i = 0; i < (4U * FFT_SAMPLE_MAX); i++)
+    {
+        const double volts = FFT_TEST_TONE_V * sin((2.0 * FFT_TEST_PI * frequencyHz * i) * FFT_SAMPLING_PERIOD_S);
+
+        FFT_GetSample((uint16_t)lround((volts * FFT_TEST_CODES_PER_VOLT) + FFT_ADC_MIDSCALE));
+        if (FFT_GetBufferReady())
+        {
+            (void)FFT_GetFrequencyResponse(freqResponsePerBand);
+        }
+    }
+}
+
+static int FFT_TestBandRejection(void)
+{
+    double centreError = 0.0;
+    double adjacent = 1000.0;
+    double others = 1000.0;
+    double mains = 1000.0;
+
+    /* Levels in dB relative to the tone, row 0 is FFT_TEST_MAINS_HZ */
+    FFT_Initialize();
+    printf("%8s", "tone Hz");
+    for (uint32_t band = 0; band < FFT_FREQ_BANDS; band++)
+    {
+        printf(" %7.0f", FFT_Frequency_Bands[band]);
+    }
+    printf("\n");
+
+    for (uint32_t tone = 0; tone <= FFT_FREQ_BANDS; tone++)
+    {
+        double frequencyHz = FFT_TEST_MAINS_HZ;
+        float bands[FFT_FREQ_BANDS] = {0};
+
+        /* The middle of a band cut at Nyquist, its nominal centre may be above */
+        if (0 != tone)
+        {
+            frequencyHz = FFT_Frequency_Bands[tone - 1];
+            if (frequencyHz >= FFT_BandEdges[tone])
+            {
+                frequencyHz = (FFT_BandEdges[tone - 1] + FFT_BandEdges[tone]) / 2;
+            }
+        }
+
+        FFT_TestToneBands(frequencyHz, &bands[0]);
+
+        printf("%8.0f", frequencyHz);
+        for (uint32_t band = 0; band < FFT_FREQ_BANDS; band++)
+        {
+            const double level = 20.0 * log10(((double)bands[band] / FFT_TEST_TONE_V) + 1e-9);
+            const int own = (frequencyHz >= FFT_BandEdges[band]) && (frequencyHz < FFT_BandEdges[band + 1]);
+
+            printf(" %7.1f", level);
+
+            if (own)
+            {
+                if ((0 != tone) && (fabs(level) > centreError))
+                {
+                    centreError = fabs(level);
+                }
+            }
+            else if (0 == tone)
+            {
+                mains = (-level < mains) ? -level : mains;
+            }
+            else if (((band + 1U) == (tone - 1U)) || (band == tone))
+            {
+                adjacent = (-level < adjacent) ? -level : adjacent;
+            }
+            else
+            {
+                others = (-level < others) ? -level : others;
+            }
+        }
+        printf("\n");
+    }
+
+    printf("centre tones read %.2fdB or closer in their band, the adjacent bands are %.1fdB\n"
+           "and the others %.1fdB or more below, a %.0fHz tone is %.1fdB or more below in other bands\n",
+           centreError, adjacent, others, FFT_TEST_MAINS_HZ, mains);
+
+    return (centreError > FFT_TEST_MAX_CENTRE_ERROR_DB) ? 1 : 0;
+}
+
+static int FFT_TestLoad(void)
+{
+    static uint16_t samples[FFT_TEST_LOAD_SAMPLES];
+    float bands[FFT_FREQ_BANDS];
+    clock_t interrupt = 0;
+    clock_t loop = 0;
+    uint32_t frames = 0;
+
+    /* Three tones and a chirp, computed before the clock runs */
+    for (uint32_t i = 0; i < FFT_TEST_LOAD_SAMPLES; i++)
+    {
+        const double t = i * FFT_SAMPLING_PERIOD_S;
+        const double volts = (0.2 * sin(2.0 * FFT_TEST_PI * 60.0 * t))
+                           + (0.1 * sin(2.0 * FFT_TEST_PI * 1000.0 * t))
+                           + (0.05 * sin(2.0 * FFT_TEST_PI * 6000.0 * t))
+                           + (0.1 * sin(2.0 * FFT_TEST_PI * (100.0 + (4000.0 * t)) * t));
+
+        samples[i] = (uint16_t)lround((volts * FFT_TEST_CODES_PER_VOLT) + FFT_ADC_MIDSCALE);
+    }
+
+    FFT_Initialize();
+
+    for (uint32_t second = 0; second < FFT_TEST_LOAD_SECONDS; second++)
+    {
+        uint32_t i = 0;
+
+        while (i < FFT_TEST_LOAD_SAMPLES)
+        {
+            /* Samples up to the next frame, then the main loop takes it */
+            clock_t start = clock();
+
+            while ((i < FFT_TEST_LOAD_SAMPLES) && (0 == FFT_GetBufferReady()))
+            {
+                FFT_GetSample(samples[i++]);
+            }
+            interrupt += clock() - start;
+
+            if (FFT_GetBufferReady())
+            {
+                start = clock();
+                frames += FFT_GetFrequencyResponse(&bands[0]);
+                loop += clock() - start;
+            }
+        }
+    }
+
+    printf("%u bands, %u frames, host time per second of audio:\n", FFT_FREQ_BANDS, frames);
+    printf("    FFT_GetSample (interrupt)  %8.1f us\n", ((double)interrupt * 1e6) / CLOCKS_PER_SEC / FFT_TEST_LOAD_SECONDS);
+    printf("    main loop                  %8.1f us\n", ((double)loop * 1e6) / CLOCKS_PER_SEC / FFT_TEST_LOAD_SECONDS);
+    printf("    total                      %8.1f us\n",
+           ((double)(interrupt + loop) * 1e6) / CLOCKS_PER_SEC / FFT_TEST_LOAD_SECONDS);
+
+    return 0;
+}
+
+#ifndef FFT_GOERTZEL
+
+static double FFT_TestRandom(void)
+{
+    /* 32 bit linear congruential generator, top 24 bits */
+    FFT_testSeed = (FFT_testSeed * 1664525U) + 1013904223U;
+
+    return ((double)(FFT_testSeed >> 8) / 8388608.0) - 1.0;
+}
+
+static void FFT_TestSignal(uint32_t signal)
+{
+    FFT_testSeed = signal + 1U;
+
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        const double t = i * FFT_SAMPLING_PERIOD_S;
+        double volts = 0.0;
+        long code;
+
+        switch (signal)
+        {
+        case 0:
+            volts = 0.5 * sin(2.0 * FFT_TEST_PI * 1000.0 * t);
+            break;
+        case 1:
+            volts = 2.4 * sin(2.0 * FFT_TEST_PI * 440.0 * t);
+            break;
+        case 2:
+            volts = (0.01 * sin(2.0 * FFT_TEST_PI * 1000.0 * t)) + (0.005 * sin(2.0 * FFT_TEST_PI * 5000.0 * t));
+            break;
+        case 3:
+            volts = FFT_TestRandom();
+            break;
+        default:
+            /* The frequency rises linearly over the frame */
+            volts = sin(2.0 * FFT_TEST_PI * ((100.0 * t) + (0.5 * (7900.0 / (FFT_SAMPLE_MAX * FFT_SAMPLING_PERIOD_S)) * t * t)));
+            break;
+        }
+
+        /* Rounded to ADC codes, plus half a code of dither */
+        code = lround((volts * FFT_TEST_CODES_PER_VOLT) + FFT_ADC_MIDSCALE + (0.5 * FFT_TestRandom()));
+        if (code < 0)
+        {
+            code = 0;
+        }
+        if (code > (long)FFT_ADC_MAX)
+        {
+            code = FFT_ADC_MAX;
+        }
+        FFT_testSamples[i] = (uint16_t)code;
+    }
+}
+
+static void FFT_TestReference(double* re, double* im)
+{
+    static double x[FFT_SAMPLE_MAX];
+    const float* window = &FFT_WindowTable[FFT_WindowRow[FFT_window]][0];
+
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        x[i] = ((double)FFT_testSamples[i] - FFT_ADC_MIDSCALE) * (FFT_ADC_REFERENCE / FFT_ADC_MAX)
+               * window[(i < (FFT_SAMPLE_MAX / 2)) ? i : (FFT_SAMPLE_MAX - 1 - i)];
+    }
+
+    for (uint32_t k = 0; k < FFT_FREQUENCY_RESP_SIZE; k++)
+    {
+        double sumRe = 0.0;
+        double sumIm = 0.0;
+        uint32_t phase = 0;
+
+        for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+        {
+            sumRe += x[i] * FFT_testCos[phase];
+            sumIm -= x[i] * FFT_testCos[(phase + ((3U * FFT_SAMPLE_MAX) / 4U)) % FFT_SAMPLE_MAX];
+            phase = (phase + k) % FFT_SAMPLE_MAX;
+        }
+
+        re[k] = sumRe / FFT_SAMPLE_MAX;
+        im[k] = sumIm / FFT_SAMPLE_MAX;
+    }
+}
+
+#ifdef FFT_FIXED_POINT
+static void FFT_TestSpectrum(double* re, double* im)
+{
+    uint32_t* audio = &FFT_Arena.audio[0];
+    const int16_t* window = &FFT_WindowTableQ15[FFT_WindowRow[FFT_window]][0];
+    const double voltsPerUnit = (FFT_ADC_REFERENCE / FFT_ADC_MAX) / (1U << FFT_ADC_TO_Q15_SHIFT) / FFT_SAMPLE_MAX;
+    int8_t exponent;
+
+    /* The same conversion and window as FFT_GetFrequencyResponseQ15 */
+#ifdef FFT_REAL_INPUT
+    for (uint32_t i = 0; i < (FFT_SAMPLE_MAX / 2); i++)
+    {
+        const int32_t even = ((int32_t)FFT_testSamples[2 * i] - FFT_ADC_MIDSCALE) * (1 << FFT_ADC_TO_Q15_SHIFT);
+        const int32_t odd = ((int32_t)FFT_testSamples[(2 * i) + 1] - FFT_ADC_MIDSCALE) * (1 << FFT_ADC_TO_Q15_SHIFT);
+
+        audio[i] = FFT_PackQ15(((even * FFT_WindowCoefficientQ15(window, 2 * i)) + 0x4000) >> 15,
+                               ((odd * FFT_WindowCoefficientQ15(window, (2 * i) + 1)) + 0x4000) >> 15);
+    }
+#else
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        const int32_t sample = ((int32_t)FFT_testSamples[i] - FFT_ADC_MIDSCALE) * (1 << FFT_ADC_TO_Q15_SHIFT);
+
+        audio[i] = FFT_PackQ15(((sample * FFT_WindowCoefficientQ15(window, i)) + 0x4000) >> 15, 0);
+    }
+#endif
+
+#ifdef FFT_REAL_INPUT
+    exponent = FFT_RealQ15(FFT_POWER_OF_TWO, &audio[0]);
+#else
+    {
+        int32_t peak;
+        exponent = FFT_Q15(FFT_POWER_OF_TWO, &audio[0], &peak);
+    }
+#endif
+
+    for (uint32_t k = 0; k < FFT_FREQUENCY_RESP_SIZE; k++)
+    {
+        re[k] = ldexp(FFT_Q15_RE(audio[k]) * voltsPerUnit, exponent);
+        im[k] = ldexp(FFT_Q15_IM(audio[k]) * voltsPerUnit, exponent);
+    }
+}
+#else
+static void FFT_TestSpectrum(double* re, double* im)
+{
+    float* audioReal = &FFT_Arena.real[0];
+    float* audioImag = &FFT_Arena.imag[0];
+    const float* window = &FFT_WindowTable[FFT_WindowRow[FFT_window]][0];
+
+    /* The same conversion and window as FFT_GetFrequencyResponse */
+#ifdef FFT_REAL_INPUT
+    for (uint32_t i = 0; i < (FFT_SAMPLE_MAX / 2); i++)
+    {
+        audioReal[i] = ((float)FFT_testSamples[2 * i] - FFT_ADC_MIDSCALE) * FFT_VOLTS_PER_COUNT
+                       * FFT_WindowCoefficient(window, 2 * i);
+        audioImag[i] = ((float)FFT_testSamples[(2 * i) + 1] - FFT_ADC_MIDSCALE) * FFT_VOLTS_PER_COUNT
+                       * FFT_WindowCoefficient(window, (2 * i) + 1);
+    }
+    FFT_Real(FFT_POWER_OF_TWO, &audioReal[0], &audioImag[0], 0);
+#else
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        audioReal[i] = ((float)FFT_testSamples[i] - FFT_ADC_MIDSCALE) * FFT_VOLTS_PER_COUNT
+                       * FFT_WindowCoefficient(window, i);
+        audioImag[i] = 0.0f;
+    }
+    FFT(1, FFT_POWER_OF_TWO, &audioReal[0], &audioImag[0]);
+#endif
+
+    for (uint32_t k = 0; k < FFT_FREQUENCY_RESP_SIZE; k++)
+    {
+        re[k] = (double)audioReal[k] / FFT_SAMPLE_MAX;
+        im[k] = (double)audioImag[k] / FFT_SAMPLE_MAX;
+    }
+}
+#endif
+
+static void FFT_TestBands(float* freqResponsePerBand)
+{
+    FFT_Initialize();
+
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        FFT_GetSample(FFT_testSamples[i]);
+    }
+
+    FFT_GetFrequencyResponse(freqResponsePerBand);
+}
+
+static void FFT_TestReferenceBands(const double* re, const double* im, float* freqResponsePerBand)
+{
+    float energy[FFT_BAND_SLOTS] = {0};
+
+    for (uint32_t bin = FFT_firstBin; bin <= FFT_lastBin; bin++)
+    {
+        /* Single sided, DC and Nyquist are not doubled */
+        const double scale = (((FFT_FREQUENCY_RESP_SIZE - 1) == bin) || (0 == bin)) ? 1.0 : 4.0;
+
+        FFT_AddBinPower(energy, bin, (float)(((re[bin] * re[bin]) + (im[bin] * im[bin])) * scale));
+    }
+
+    FFT_GetBandLevels(energy, freqResponsePerBand);
+}
+
+static double FFT_TestSnr(const double* re, const double* im, const double* refRe, const double* refIm,
+                          double* worst)
+{
+    double signalPower = 0.0;
+    double errorPower = 0.0;
+    double worstError = 0.0;
+    double peak = 0.0;
+
+    for (uint32_t k = 0; k < FFT_FREQUENCY_RESP_SIZE; k++)
+    {
+        const double dr = re[k] - refRe[k];
+        const double di = im[k] - refIm[k];
+        const double power = (refRe[k] * refRe[k]) + (refIm[k] * refIm[k]);
+        const double error = (dr * dr) + (di * di);
+
+        signalPower += power;
+        errorPower += error;
+        if (power > peak)
+        {
+            peak = power;
+        }
+        if (error > worstError)
+        {
+            worstError = error;
+        }
+    }
+
+    *worst = 10.0 * log10((worstError + 1e-300) / (peak + 1e-300));
+    return 10.0 * log10((signalPower + 1e-300) / (errorPower + 1e-300));
+}
+
+static int FFT_TestAccuracy(void)
+{
+    int failed = 0;
+
+    /* SNR of all bins, the worst bin error relative to the strongest bin
+     * and the worst band level error */
+    printf("%-24s %8s %10s %10s\n", "signal", "SNR dB", "worst dB", "bands dB");
+
+    for (uint32_t signal = 0; signal < FFT_TEST_SIGNALS; signal++)
+    {
+        float bands[FFT_FREQ_BANDS];
+        float refBands[FFT_FREQ_BANDS];
+        double bandError = 0.0;
+        double strongest = 0.0;
+        double snr;
+        double worst;
+
+        FFT_TestSignal(signal);
+        FFT_TestReference(&FFT_refRe[0], &FFT_refIm[0]);
+        FFT_TestSpectrum(&FFT_testRe[0], &FFT_testIm[0]);
+        snr = FFT_TestSnr(&FFT_testRe[0], &FFT_testIm[0], &FFT_refRe[0], &FFT_refIm[0], &worst);
+
+        /* Band levels of the whole path, from the ring to the volts */
+        FFT_TestBands(&bands[0]);
+        FFT_TestReferenceBands(&FFT_refRe[0], &FFT_refIm[0], &refBands[0]);
+        for (uint32_t band = 0; band < FFT_FREQ_BANDS; band++)
+        {
+            if (refBands[band] > strongest)
+            {
+                strongest = refBands[band];
+            }
+        }
+        for (uint32_t band = 0; band < FFT_FREQ_BANDS; band++)
+        {
+            if ((20.0 * log10(strongest / refBands[band])) <= FFT_TEST_BAND_RANGE_DB)
+            {
+                const double error = fabs(20.0 * log10((double)bands[band] / refBands[band]));
+
+                if (error > bandError)
+                {
+                    bandError = error;
+                }
+            }
+        }
+
+        printf("%-24s %8.1f %10.1f %10.4f\n", FFT_TestSignalNames[signal], snr, worst, bandError);
+
+        if ((snr < FFT_TEST_MIN_SNR_DB) || (bandError > FFT_TEST_MAX_BAND_ERROR_DB))
+        {
+            failed = 1;
+        }
+    }
+
+    printf("%s: SNR at least %.0fdB, bands down to %.0fdB below the strongest within %gdB\n",
+           failed ? "FAILED" : "passed", FFT_TEST_MIN_SNR_DB, FFT_TEST_BAND_RANGE_DB, FFT_TEST_MAX_BAND_ERROR_DB);
+
+    return failed;
+}
+
+static int FFT_TestBench(void)
+{
+    float bands[FFT_FREQ_BANDS];
+    clock_t start;
+    double transform;
+    double response;
+
+    FFT_TestSignal(4U);
+
+    start = clock();
+    for (uint32_t frame = 0; frame < FFT_TEST_BENCH_FRAMES; frame++)
+    {
+        FFT_TestSpectrum(&FFT_testRe[0], &FFT_testIm[0]);
+    }
+    transform = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    /* The same frame over and over, marked ready again each time */
+    FFT_TestBands(&bands[0]);
+    start = clock();
+    for (uint32_t frame = 0; frame < FFT_TEST_BENCH_FRAMES; frame++)
+    {
+        FFT_frameCount++;
+        FFT_GetFrequencyResponse(&bands[0]);
+    }
+    response = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%u points, host time per frame:\n", FFT_SAMPLE_MAX);
+    printf("    window and transform       %8.1f us\n", transform * 1e6 / FFT_TEST_BENCH_FRAMES);
+    printf("    FFT_GetFrequencyResponse   %8.1f us\n", response * 1e6 / FFT_TEST_BENCH_FRAMES);
+
+    return FFT_TestLoad();
+}
+
+static int FFT_TestLoadFrame(uint32_t frame, FILE* recording)
+{
+    uint8_t bytes[2 * FFT_SAMPLE_MAX];
+
+    if (0 == recording)
+    {
+        if (frame >= FFT_TEST_SIGNALS)
+        {
+            return 0;
+        }
+        FFT_TestSignal(frame);
+        return 1;
+    }
+
+    if (fread(&bytes[0], sizeof(bytes), 1, recording) != 1)
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        FFT_testSamples[i] = (uint16_t)(bytes[2 * i] | (bytes[(2 * i) + 1] << 8)) & FFT_ADC_MAX;
+    }
+    return 1;
+}
+
+static int FFT_TestSnrAgainst(int save, const char* spectra, const char* recording)
+{
+    FILE* saved = fopen(spectra, save ? "wb" : "rb");
+    FILE* input = recording ? fopen(recording, "rb") : 0;
+    double lowest = 1e300;
+    double sum = 0.0;
+    uint32_t frame = 0;
+    int failed = 0;
+
+    if ((0 == saved) || (recording && (0 == input)))
+    {
+        fprintf(stderr, "cannot open %s\n", ((0 == saved) ? spectra : recording));
+        failed = 1;
+    }
+
+    for (; (0 == failed) && FFT_TestLoadFrame(frame, input); frame++)
+    {
+        double snr;
+        double worst;
+
+        FFT_TestSpectrum(&FFT_testRe[0], &FFT_testIm[0]);
+
+        if (save)
+        {
+            if ((fwrite(&FFT_testRe[0], sizeof(FFT_testRe), 1, saved) != 1)
+                || (fwrite(&FFT_testIm[0], sizeof(FFT_testIm), 1, saved) != 1))
+            {
+                fprintf(stderr, "cannot write %s\n", spectra);
+                failed = 1;
+            }
+            continue;
+        }
+
+        if ((fread(&FFT_refRe[0], sizeof(FFT_refRe), 1, saved) != 1)
+            || (fread(&FFT_refIm[0], sizeof(FFT_refIm), 1, saved) != 1))
+        {
+            fprintf(stderr, "%s has fewer frames or another FFT_SAMPLE_MAX\n", spectra);
+            failed = 1;
+            break;
+        }
+
+        snr = FFT_TestSnr(&FFT_testRe[0], &FFT_testIm[0], &FFT_refRe[0], &FFT_refIm[0], &worst);
+        if (snr < lowest)
+        {
+            lowest = snr;
+        }
+        sum += snr;
+
+        if (0 == recording)
+        {
+            printf("%-24s %8.1f dB SNR, worst bin %.1f dB\n", FFT_TestSignalNames[frame], snr, worst);
+        }
+    }
+
+    if ((0 == failed) && save)
+    {
+        printf("saved %u frames to %s\n", frame, spectra);
+    }
+    else if ((0 == failed) && (frame > 0))
+    {
+        printf("%u frames, SNR %.1f dB mean, %.1f dB lowest\n", frame, sum / frame, lowest);
+    }
+
+    if (saved)
+    {
+        (void)fclose(saved);
+    }
+    if (input)
+    {
+        (void)fclose(input);
+    }
+    return failed;
+}
+
+static void FFT_TestDft(uint32_t n, const double* inRe, const double* inIm, double* outRe, double* outIm)
+{
+    const uint32_t stride = FFT_SAMPLE_MAX / n;
+
+    for (uint32_t k = 0; k < n; k++)
+    {
+        double sumRe = 0.0;
+        double sumIm = 0.0;
+        uint32_t phase = 0;
+
+        /* e^(-2*pi*i*k*j/n), the quarter turn shift gives the sine */
+        for (uint32_t j = 0; j < n; j++)
+        {
+            const double c = FFT_testCos[phase * stride];
+            const double s = FFT_testCos[((phase * stride) + ((3U * FFT_SAMPLE_MAX) / 4U)) % FFT_SAMPLE_MAX];
+
+            sumRe += (inRe[j] * c) + (inIm[j] * s);
+            sumIm += (inIm[j] * c) - (inRe[j] * s);
+            phase = (phase + k) % n;
+        }
+
+        outRe[k] = sumRe;
+        outIm[k] = sumIm;
+    }
+}
+
+static double FFT_TestKernelSnr(uint32_t n, const double* re, const double* im, const double* refRe,
+                                const double* refIm)
+{
+    double signalPower = 0.0;
+    double errorPower = 0.0;
+
+    for (uint32_t k = 0; k < n; k++)
+    {
+        const double dr = re[k] - refRe[k];
+        const double di = im[k] - refIm[k];
+
+        signalPower += (refRe[k] * refRe[k]) + (refIm[k] * refIm[k]);
+        errorPower += (dr * dr) + (di * di);
+    }
+
+    return 10.0 * log10((signalPower + 1e-300) / (errorPower + 1e-300));
+}
+
+static int FFT_TestKernelResult(const char* kernel, long m, double snr)
+{
+    const int failed = (snr < FFT_TEST_MIN_KERNEL_SNR_DB) ? 1 : 0;
+
+    printf("%-16s %5ld %8.1f%s\n", kernel, 1L << m, snr, failed ? "  FAILED" : "");
+    return failed;
+}
+
+#ifdef FFT_FIXED_POINT
+static int FFT_TestKernels(void)
+{
+    int failed = 0;
+
+    printf("%-16s %5s %8s\n", "kernel", "n", "SNR dB");
+
+    for (long m = 1; m <= (long)FFT_TABLE_POWER_OF_TWO; m++)
+    {
+        const uint32_t n = 1U << m;
+        int32_t peak;
+        int8_t exponent;
+
+        /* Random values up to half scale, then the same value everywhere
+         * at full scale, which saturates unless every stage is scaled */
+        for (uint32_t pass = 0; pass < 2; pass++)
+        {
+            FFT_testSeed = (uint32_t)m;
+            for (uint32_t i = 0; i < n; i++)
+            {
+                const int32_t re = (0 == pass) ? (int32_t)lround(16384.0 * FFT_TestRandom()) : 32767;
+                const int32_t im = (0 == pass) ? (int32_t)lround(16384.0 * FFT_TestRandom()) : -32768;
+
+                FFT_kernelInRe[i] = re;
+                FFT_kernelInIm[i] = im;
+                FFT_kernelData[i] = FFT_PackQ15(re, im);
+            }
+            FFT_TestDft(n, &FFT_kernelInRe[0], &FFT_kernelInIm[0], &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]);
+
+            exponent = FFT_Q15(m, &FFT_kernelData[0], &peak);
+            for (uint32_t k = 0; k < n; k++)
+            {
+                FFT_kernelOutRe[k] = ldexp(FFT_Q15_RE(FFT_kernelData[k]), exponent);
+                FFT_kernelOutIm[k] = ldexp(FFT_Q15_IM(FFT_kernelData[k]), exponent);
+            }
+            failed |= FFT_TestKernelResult((0 == pass) ? "FFT_Q15" : "FFT_Q15 full", m,
+                                           FFT_TestKernelSnr(n, &FFT_kernelOutRe[0], &FFT_kernelOutIm[0],
+                                                             &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]));
+        }
+
+#ifdef FFT_REAL_INPUT
+        if (m >= 2)
+        {
+            /* Real samples, even ones in the real and odd ones in the imaginary half words */
+            FFT_testSeed = (uint32_t)m + 100U;
+            for (uint32_t i = 0; i < n; i++)
+            {
+                FFT_kernelInRe[i] = (double)lround(16384.0 * FFT_TestRandom());
+                FFT_kernelInIm[i] = 0.0;
+            }
+            for (uint32_t i = 0; i < (n / 2); i++)
+            {
+                FFT_kernelData[i] = FFT_PackQ15((int32_t)FFT_kernelInRe[2 * i], (int32_t)FFT_kernelInRe[(2 * i) + 1]);
+            }
+            FFT_TestDft(n, &FFT_kernelInRe[0], &FFT_kernelInIm[0], &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]);
+
+            exponent = FFT_RealQ15(m, &FFT_kernelData[0]);
+            for (uint32_t k = 0; k <= (n / 2); k++)
+            {
+                FFT_kernelOutRe[k] = ldexp(FFT_Q15_RE(FFT_kernelData[k]), exponent);
+                FFT_kernelOutIm[k] = ldexp(FFT_Q15_IM(FFT_kernelData[k]), exponent);
+            }
+            failed |= FFT_TestKernelResult("FFT_RealQ15", m,
+                                           FFT_TestKernelSnr((n / 2) + 1, &FFT_kernelOutRe[0], &FFT_kernelOutIm[0],
+                                                             &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]));
+        }
+#endif
+    }
+
+    printf("%s: SNR at least %.0fdB\n", failed ? "FAILED" : "passed", FFT_TEST_MIN_KERNEL_SNR_DB);
+    return failed;
+}
+#else
+static int FFT_TestKernels(void)
+{
+    int failed = 0;
+
+    printf("%-16s %5s %8s\n", "kernel", "n", "SNR dB");
+
+    for (long m = 1; m <= (long)FFT_TABLE_POWER_OF_TWO; m++)
+    {
+        const uint32_t n = 1U << m;
+        int reversed = 1;
+
+        /* The bit reversal of the indexes, from the table for FFT_TABLE_SIZE
+         * and FFT_TABLE_SIZE / 2 points and computed for the others */
+        for (uint32_t i = 0; i < n; i++)
+        {
+            FFT_kernelRe[i] = (float)i;
+            FFT_kernelIm[i] = -(float)i;
+        }
+        FFT_BitReverse(m, &FFT_kernelRe[0], &FFT_kernelIm[0]);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            uint32_t j = 0;
+
+            for (long bit = 0; bit < m; bit++)
+            {
+                j |= ((i >> bit) & 1U) << (m - 1 - bit);
+            }
+            if ((FFT_kernelRe[i] != (float)j) || (FFT_kernelIm[i] != -(float)j))
+            {
+                reversed = 0;
+            }
+        }
+        printf("%-16s %5u %8s%s\n", "FFT_BitReverse", n, reversed ? "exact" : "wrong", reversed ? "" : "  FAILED");
+        failed |= !reversed;
+
+        /* Forward transform of random complex values */
+        FFT_testSeed = (uint32_t)m;
+        for (uint32_t i = 0; i < n; i++)
+        {
+            FFT_kernelRe[i] = (float)FFT_TestRandom();
+            FFT_kernelIm[i] = (float)FFT_TestRandom();
+            FFT_kernelInRe[i] = FFT_kernelRe[i];
+            FFT_kernelInIm[i] = FFT_kernelIm[i];
+        }
+        FFT_TestDft(n, &FFT_kernelInRe[0], &FFT_kernelInIm[0], &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]);
+
+        FFT(1, m, &FFT_kernelRe[0], &FFT_kernelIm[0]);
+        for (uint32_t k = 0; k < n; k++)
+        {
+            FFT_kernelOutRe[k] = FFT_kernelRe[k];
+            FFT_kernelOutIm[k] = FFT_kernelIm[k];
+        }
+        failed |= FFT_TestKernelResult("FFT", m, FFT_TestKernelSnr(n, &FFT_kernelOutRe[0], &FFT_kernelOutIm[0],
+                                                                   &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]));
+
+        /* The inverse brings back n times the input */
+        FFT(-1, m, &FFT_kernelRe[0], &FFT_kernelIm[0]);
+        for (uint32_t k = 0; k < n; k++)
+        {
+            FFT_kernelOutRe[k] = (double)FFT_kernelRe[k] / n;
+            FFT_kernelOutIm[k] = (double)FFT_kernelIm[k] / n;
+        }
+        failed |= FFT_TestKernelResult("FFT inverse", m, FFT_TestKernelSnr(n, &FFT_kernelOutRe[0], &FFT_kernelOutIm[0],
+                                                                           &FFT_kernelInRe[0], &FFT_kernelInIm[0]));
+
+#ifdef FFT_REAL_INPUT
+        if (m >= 2)
+        {
+            /* Real samples, even ones in re and odd ones in im */
+            FFT_testSeed = (uint32_t)m + 100U;
+            for (uint32_t i = 0; i < n; i++)
+            {
+                FFT_kernelInRe[i] = (float)FFT_TestRandom();
+                FFT_kernelInIm[i] = 0.0;
+            }
+            for (uint32_t i = 0; i < (n / 2); i++)
+            {
+                FFT_kernelRe[i] = (float)FFT_kernelInRe[2 * i];
+                FFT_kernelIm[i] = (float)FFT_kernelInRe[(2 * i) + 1];
+            }
+            FFT_TestDft(n, &FFT_kernelInRe[0], &FFT_kernelInIm[0], &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]);
+
+            FFT_Real(m, &FFT_kernelRe[0], &FFT_kernelIm[0], 0);
+            for (uint32_t k = 0; k <= (n / 2); k++)
+            {
+                FFT_kernelOutRe[k] = FFT_kernelRe[k];
+                FFT_kernelOutIm[k] = FFT_kernelIm[k];
+            }
+            failed |= FFT_TestKernelResult("FFT_Real", m,
+                                           FFT_TestKernelSnr((n / 2) + 1, &FFT_kernelOutRe[0], &FFT_kernelOutIm[0],
+                                                             &FFT_kernelRefRe[0], &FFT_kernelRefIm[0]));
+        }
+#endif
+    }
+
+    printf("%s: bit reversal exact, SNR at least %.0fdB\n", failed ? "FAILED" : "passed", FFT_TEST_MIN_KERNEL_SNR_DB);
+    return failed;
+}
+#endif
+#endif /* !FFT_GOERTZEL */
+
+int main(int argc, char** argv)
+{
+#ifdef FFT_GOERTZEL
+    const char* test = (argc > 1) ? argv[1] : "bands";
+
+    printf("Goertzel filter bank\n");
+
+    if (0 == strcmp(test, "bands"))
+    {
+        return FFT_TestBandRejection();
+    }
+    if (0 == strcmp(test, "bench"))
+    {
+        return FFT_TestLoad();
+    }
+
+    fprintf(stderr, "usage: %s [bands | bench]\n", argv[0]);
+    return 2;
+#else
+    const char* test = (argc > 1) ? argv[1] : "accuracy";
+
+    printf("%s, %s, %s, window %u\n",
+#ifdef FFT_FIXED_POINT
+           "Q15",
+#else
+           "float",
+#endif
+#ifdef FFT_REAL_INPUT
+           "real input",
+#else
+           "complex",
+#endif
+#ifdef FFT_RADIX4
+           "radix-4",
+#else
+           "radix-2",
+#endif
+           FFT_window);
+
+    for (uint32_t i = 0; i < FFT_SAMPLE_MAX; i++)
+    {
+        FFT_testCos[i] = cos((2.0 * FFT_TEST_PI * i) / FFT_SAMPLE_MAX);
+    }
+
+    if (0 == strcmp(test, "accuracy"))
+    {
+        return FFT_TestAccuracy();
+    }
+    if (0 == strcmp(test, "bench"))
+    {
+        return FFT_TestBench();
+    }
+    if (0 == strcmp(test, "kernels"))
+    {
+        return FFT_TestKernels();
+    }
+    if (0 == strcmp(test, "bands"))
+    {
+        return FFT_TestBandRejection();
+    }
+
+    if ((0 == strcmp(test, "snr")) && (argc >= 4)
+        && ((0 == strcmp(argv[2], "save")) || (0 == strcmp(argv[2], "compare"))))
+    {
+        return FFT_TestSnrAgainst(0 == strcmp(argv[2], "save"), argv[3], (argc > 4) ? argv[4] : 0);
+    }
+
+    fprintf(stderr, "usage: %s [accuracy | bench | kernels | bands | snr save|compare <spectra> [<recording>]]\n",
+            argv[0]);
+    return 2;
+#endif
+}
@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+"""
+Font compiler for the TFT_ST7735 library.
+
+Converts a BDF bitmap font, or a TrueType/OpenType font rendered at a given
+pixel size, into a C file holding a fontindexed structure (see TFT_ST7735.h).
+
+Every glyph gets its own bounding box, advance and offset in the bitmap array.
+Bitmaps are Run Length Encoded one row at a time, so the renderer can decode
+a row straight into its line buffer. With 1 bit per pixel:
+
+    bit 7 set   (n & 0x7F) + 1 foreground pixels
+    bit 7 clear  n + 1 background pixels
+
+TrueType fonts can also be anti-aliased with 2 or 4 bits per pixel (--bpp):
+
+    00nnnnnn    n + 1 background pixels
+    01nnnnnn    n + 1 foreground pixels
+    1nnnnnnn    followed by n + 1 pixel levels packed MSB first
+
+Usage:
+
+    fontconv.py DejaVuSans.ttf -s 14 -n dejavu14 -o ../s32k1_st7735/Sources/tft_st7735/fonts
+    fontconv.py 6x13.bdf -n fixed6x13 -r 32-126,0xB0,0xB5,0x3A9
+    fontconv.py DejaVuSans-Bold.ttf -s 40 -n digits40 -r 0x2D-0x3A --bpp 4
+
+Character sets with gaps get a sorted code table, searched by the library
+with a binary search, instead of blank entries for the missing codes.
+
+This writes <name>.c and <name>.h. Add the .c file to the build, then:
+
+    TFT_ST7735_loadFont(&dejavu14);
+    TFT_ST7735_drawString("Hello", 0, 0, TFT_LOADED_FONT);
+
+TrueType fonts need Pillow (pip install pillow), BDF fonts need nothing else.
+"""
+
+import argparse
+import os
+import sys
+
+
+class Glyph:
+    def __init__(self, code, advance, x, y, rows):
+        self.code = code
+        self.advance = advance
+        self.x = x          # Bounding box position from the top left of the cell
+        self.y = y
+        self.rows = rows    # List of rows, each a list of pixel levels, 0 is background
+
+    def trim(self):
+        """Shrink the bounding box to the inked pixels."""
+        rows = self.rows
+        while rows and not any(rows[0]):
+            rows = rows[1:]
+            self.y += 1
+        while rows and not any(rows[-1]):
+            rows = rows[:-1]
+        if not rows:
+            self.rows = []
+            self.x = self.y = 0
+            return
+        inked = [[i for i, v in enumerate(r) if v] for r in rows]
+        left = min(i[0] for i in inked if i)
+        right = max(i[-1] + 1 for i in inked if i)
+        self.rows = [r[left:right] for r in rows]
+        self.x += left
+
+
+def load_bdf(path, wanted):
+    glyphs = {}
+    ascent = descent = None
+    with open(path, 'r', encoding='latin-1') as f:
+        lines = iter(f.read().splitlines())
+
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'FONT_ASCENT':
+            ascent = int(words[1])
+        elif words[0] == 'FONT_DESCENT':
+            descent = int(words[1])
+        elif words[0] == 'STARTCHAR':
+            code = advance = None
+            bbx = (0, 0, 0, 0)
+            bitmap = []
+            for line in lines:
+                words = line.split()
+                if words[0] == 'ENCODING':
+                    code = int(words[1])
+                elif words[0] == 'DWIDTH':
+                    advance = int(words[1])
+                elif words[0] == 'BBX':
+                    bbx = tuple(int(w) for w in words[1:5])
+                elif words[0] == 'BITMAP':
+                    for line in lines:
+                        if line.startswith('ENDCHAR'):
+                            break
+                        bitmap.append(line.strip())
+                    break
+            if code not in wanted:
+                continue
+            w, h, xoff, yoff = bbx
+            rows = []
+            for hexrow in bitmap:
+                value = int(hexrow, 16)
+                bits = len(hexrow) * 4
+                rows.append([(value >> (bits - 1 - i)) & 1 for i in range(w)])
+            if ascent is None or descent is None:
+                sys.exit('%s: FONT_ASCENT/FONT_DESCENT missing' % path)
+            # yoff is the bottom of the box from the baseline
+            glyphs[code] = Glyph(code, advance if advance is not None else w, xoff, ascent - (yoff + h), rows)
+
+    return glyphs, ascent + descent, ascent
+
+
+def load_ttf(path, size, wanted, threshold, bpp):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit('TrueType fonts need Pillow: pip install pillow')
+
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    margin = size
+    glyphs = {}
+
+    for code in sorted(wanted):
+        ch = chr(code)
+        if font.getmask(ch).size == (0, 0) and not ch.isspace():
+            continue  # Not in the font
+        advance = int(round(font.getlength(ch)))
+        img = Image.new('L', (advance + 3 * margin, ascent + descent + 2 * margin), 0)
+        ImageDraw.Draw(img).text((margin, margin), ch, font=font, fill=255)
+        w, h = img.size
+        px = img.load()
+        if bpp == 1:
+            rows = [[1 if px[i, j] >= threshold else 0 for i in range(w)] for j in range(h)]
+        else:
+            top = (1 << bpp) - 1
+            rows = [[(px[i, j] * top + 127) // 255 for i in range(w)] for j in range(h)]
+        glyphs[code] = Glyph(code, advance, -margin, -margin, rows)
+
+    return glyphs, ascent + descent, ascent
+
+
+def rle_rows(rows, bpp):
+    out = []
+    top = (1 << bpp) - 1
+    for row in rows:
+        i = 0
+        while i < len(row):
+            v = row[i]
+            n = 1
+            while i + n < len(row) and row[i + n] == v and n < (128 if bpp == 1 else 64):
+                n += 1
+            if bpp == 1:
+                out.append((0x80 if v else 0x00) | (n - 1))
+            elif v in (0, top) and (n > 1 or i + 1 == len(row) or row[i + 1] in (0, top)):
+                out.append((0x40 if v else 0x00) | (n - 1))
+            else:
+                # Literal levels up to the next run of background or full pixels
+                n = 1
+                while i + n < len(row) and n < 128:
+                    if row[i + n] in (0, top) and i + n + 1 < len(row) and row[i + n + 1] == row[i + n]:
+                        break
+                    n += 1
+                out.append(0x80 | (n - 1))
+                packed = 0
+                bits = 0
+                for level in row[i:i + n]:
+                    packed = (packed << bpp) | level
+                    bits += bpp
+                    if bits == 8:
+                        out.append(packed)
+                        packed = bits = 0
+                if bits:
+                    out.append(packed << (8 - bits))
+            i += n
+    return out
+
+
+def c_array(data, indent='    ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x%02X' % b for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Compile a BDF/TTF font into a TFT_ST7735 indexed font')
+    ap.add_argument('font', help='.bdf, .ttf or .otf file')
+    ap.add_argument('-s', '--size', type=int, default=16, help='pixel size for TrueType fonts')
+    ap.add_argument('-r', '--range', default='32-126', help='character codes, e.g. 32-126,0xB0')
+    ap.add_argument('-n', '--name', help='C name of the font, default from the file name')
+    ap.add_argument('-o', '--outdir', default='.', help='directory for the .c and .h files')
+    ap.add_argument('-t', '--threshold', type=int, default=128, help='TrueType ink level 0-255 at 1 bpp')
+    ap.add_argument('-b', '--bpp', type=int, default=1, choices=(1, 2, 4), help='bits per pixel, 2 and 4 are anti-aliased')
+    args = ap.parse_args()
+
+    wanted = set()
+    for part in args.range.split(','):
+        lo, _, hi = part.partition('-')
+        wanted.update(range(int(lo, 0), int(hi or lo, 0) + 1))
+    if max(wanted) > 0xFFFF:
+        sys.exit('only character codes up to 0xFFFF are supported')
+    name = args.name or os.path.splitext(os.path.basename(args.font))[0].replace('-', '_').lower()
+
+    if args.font.lower().endswith('.bdf'):
+        glyphs, height, baseline = load_bdf(args.font, wanted)
+        for g in glyphs.values():
+            g.rows = [[v * ((1 << args.bpp) - 1) for v in r] for r in g.rows]
+    else:
+        glyphs, height, baseline = load_ttf(args.font, args.size, wanted, args.threshold, args.bpp)
+
+    for g in glyphs.values():
+        g.trim()
+
+    codes = sorted(glyphs)
+    if not codes:
+        sys.exit('no characters in range %s' % args.range)
+    first, last = codes[0], codes[-1]
+
+    # Small gaps become blank glyphs so the index stays direct, a code table
+    # (2 bytes per glyph) is used when it is smaller than the blank entries
+    # (12 bytes each)
+    gaps = last - first + 1 - len(codes)
+    sparse = gaps * 12 > len(codes) * 2
+    if not sparse:
+        codes = list(range(first, last + 1))
+
+    bitmap = []
+    entries = []
+    for code in codes:
+        g = glyphs.get(code)
+        if g is None:
+            entries.append((len(bitmap), 0, 0, 0, 0, 0, code))
+            continue
+        w = len(g.rows[0]) if g.rows else 0
+        h = len(g.rows)
+        if w > 255 or h > 255 or g.advance > 255 or not (-128 <= g.x <= 127 and -128 <= g.y <= 127):
+            sys.exit('character %d is too large for the indexed format' % code)
+        entries.append((len(bitmap), w, h, g.advance, g.x, g.y, code))
+        bitmap += rle_rows(g.rows, args.bpp)
+
+    guard = 'FONT_%s_H' % name.upper()
+    with open(os.path.join(args.outdir, name + '.h'), 'w') as f:
+        f.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+        f.write('// Generated by tools/fontconv.py from %s\n\n' % os.path.basename(args.font))
+        f.write('extern const fontindexed %s;\n\n#endif\n' % name)
+
+    with open(os.path.join(args.outdir, name + '.c'), 'w') as f:
+        f.write('// Generated by tools/fontconv.py from %s\n' % os.path.basename(args.font))
+        f.write('// %d characters, %d to %d, %d pixels high, %d bpp, %d bytes of RLE data\n\n'
+                % (len(codes), first, last, height, args.bpp, len(bitmap)))
+        f.write('#include "../TFT_ST7735.h"\n\n')
+        f.write('static const uint8_t %s_bitmap[] =\n{\n%s\n};\n\n' % (name, c_array(bitmap or [0])))
+        f.write('static const fontglyph %s_glyph[] =\n{\n' % name)
+        f.write('    // offset, width, height, advance, xOffset, yOffset\n')
+        for e in entries:
+            label = chr(e[6]) if 32 < e[6] < 127 and e[6] != 92 else 'U+%04X' % e[6]
+            f.write('    { %5d, %3d, %3d, %3d, %4d, %4d }, // %s\n' % (e[:6] + (label,)))
+        f.write('};\n\n')
+        if sparse:
+            f.write('static const uint16_t %s_codes[] =\n{\n' % name)
+            for i in range(0, len(codes), 8):
+                f.write('    ' + ', '.join('0x%04X' % c for c in codes[i:i + 8]) + ',\n')
+            f.write('};\n\n')
+        f.write('const fontindexed %s =\n{\n    %s_bitmap, %s_glyph, %s, %d, %d, %d, %d, %d, %d\n};\n'
+                % (name, name, name, name + '_codes' if sparse else '0',
+                   first, last, len(codes), height, baseline, args.bpp))
+
+    print('%s: %d characters%s, %d bytes of RLE data'
+          % (name, len(codes), ' (sparse)' if sparse else '', len(bitmap)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,17 @@
+/***************************************************
+  DESCRIPTION
+
+  Host stand-in for the S32 SDK Cpu.h, so that fft_app.c builds into
+  tools/fft_test.c on a PC. fft_app.c needs nothing from the SDK, the
+  test calls FFT_GetSample itself instead of the ADC interrupt.
+
+  Use at your own risk.
+
+ ****************************************************/
+
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdint.h>
+
+#endif /* CPU_H */
@@ -0,0 +1,594 @@
+/***************************************************
+  DESCRIPTION
+
+  Host test of the ST7735 driver (s32k1_st7735/Sources/tft_st7735).
+
+  It includes TFT_ST7735.c, so the static helpers are tested exactly as
+  they are built for the S32K144, and runs on a PC:
+
+    format    TFT_ST7735_formatFixed for every field size and number of
+              decimals initNumField and initSevenSeg accept: the string
+              fills the field and no more, keeps the sign and reads the
+              value, or the largest magnitude that fits when it does not
+    sevenseg  the commands and pixels sent by TFT_ST7735_drawSevenSeg:
+              going from 8 to 3 must repaint exactly segments E and F,
+              and the update is compared with redrawing a Font 7 glyph
+    textbox   TFT_ST7735_drawTextBox with changedOnly: a line is skipped
+              only when its text is unchanged, and the box then matches
+              the new text drawn from scratch
+    glyphcache  with TFT_ST7735_GLYPH_CACHE_BYTES defined (add
+              -DTFT_ST7735_GLYPH_CACHE_BYTES=4096): a character partly off
+              screen leaves the cache as it was
+
+  The SPI callouts feed an emulation of the controller RAM: CASET and
+  RASET set the window, RAMWR streams pixels into it. It counts every
+  command byte and pixel, and marks the pixels written.
+
+  Build and run it from the repository root, with the address sanitizer
+  to catch a write outside the field:
+
+    S=s32k1_st7735/Sources
+    cc -std=c99 -g -fsanitize=address,undefined -Itools/host -I$S/tft_st7735 \
+        -o tft_test tools/tft_test.c $S/tft_st7735/TFT_ST7735_fontinfo.c \
+        $S/tft_st7735/fonts/[A-Za-z]*.c
+    ./tft_test format
+    ./tft_test sevenseg
+    ./tft_test textbox
+    ./tft_test glyphcache
+
+  The exit status is 1 when a check fails.
+
+  Use at your own risk.
+
+ ****************************************************/
+
+//////////////////////////////////////////////////////////////////////
+/// Include files
+//////////////////////////////////////////////////////////////////////
+
+#include "TFT_ST7735.c"
+
+//////////////////////////////////////////////////////////////////////
+/// Defines
+//////////////////////////////////////////////////////////////////////
+
+/* Written past the end of the string, an overflow changes it */
+#define TFT_TEST_CANARY                                 ('#')
+
+/* Controller RAM, larger than the 132 x 162 of the ST7735 */
+#define TFT_TEST_RAM_SIZE                               (256U)
+
+/* Seven segment digit cell under test, Font 7 colours */
+#define TFT_TEST_SEG_X                                  (20)
+#define TFT_TEST_SEG_Y                                  (20)
+#define TFT_TEST_ON                                     (ST7735_YELLOW)
+#define TFT_TEST_OFF                                    (ST7735_BLACK)
+
+/* Text box under test */
+#define TFT_TEST_BOX_W                                  (150)
+#define TFT_TEST_BOX_H                                  (100)
+#define TFT_TEST_BOX_FONT                               (2)
+
+//////////////////////////////////////////////////////////////////////
+/// Variables
+//////////////////////////////////////////////////////////////////////
+
+/* Emulated controller: the pixels, which were written since the last
+ * TFT_TestReset, the window and the write position */
+static uint16_t TFT_testRam[TFT_TEST_RAM_SIZE][TFT_TEST_RAM_SIZE];
+static uint8_t TFT_testWritten[TFT_TEST_RAM_SIZE][TFT_TEST_RAM_SIZE];
+static TFT_ST7735_Data_Command_T TFT_testDc = REQUEST_DATA;
+static uint8_t TFT_testCommand;
+static uint8_t TFT_testParameter;        /* Data bytes since the command */
+static uint16_t TFT_testColumn[2];
+static uint16_t TFT_testRow[2];
+static uint16_t TFT_testX;
+static uint16_t TFT_testY;
+static uint8_t TFT_testHighByte;
+
+/* What was sent since the last TFT_TestReset */
+static uint32_t TFT_testCommands;
+static uint32_t TFT_testPixels;
+
+//////////////////////////////////////////////////////////////////////
+/// Function prototypes
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * Format a value and check the string against what the field can show
+ * @param value - scaled by 10^decimals
+ * @param chars - field size, sign and decimal point included
+ * @param decimals - 0 or at most chars - 2
+ * @param expected - the exact string, or 0 to check only its properties
+ * @return 0 if it passed
+ */
+static int TFT_TestFormat(int32_t value, uint8_t chars, uint8_t decimals, const char *expected);
+
+/**
+ * Check formatFixed on the cases found in review, then on every field size
+ * and a range of values, and that initNumField leaves room for the point
+ * @return 0 if every check passed
+ */
+static int TFT_TestFormats(void);
+
+/**
+ * Clear the counters and the written marks, and optionally the pixels
+ * @param clear - 1 to fill the controller RAM with TFT_TEST_OFF
+ */
+static void TFT_TestReset(uint8_t clear);
+
+/**
+ * Count the pixels that differ between two snapshots of the controller RAM
+ * @param written - 1 to also require that exactly those pixels were written
+ *                  since the last TFT_TestReset
+ * @return differing pixels, or -1 if written differs from them
+ */
+static int32_t TFT_TestDiffer(const uint16_t (*a)[TFT_TEST_RAM_SIZE], const uint16_t (*b)[TFT_TEST_RAM_SIZE], uint8_t written);
+
+/**
+ * Paint 8 then 3 on a fresh one digit display and check the update
+ * against the two digits drawn from scratch, then compare its cost with
+ * redrawing the Font 7 glyph
+ * @return 0 if the update sent exactly segments E and F
+ */
+static int TFT_TestSevenSeg(void);
+
+/**
+ * Draw a text box, then redraw it with changedOnly and compare the lines
+ * sent and the result with the new text drawn from scratch
+ * @param before - text on screen
+ * @param after - text drawn with changedOnly
+ * @param lines - lines that must be repainted
+ * @return 0 if it passed
+ */
+static int TFT_TestTextBox(char *before, char *after, uint8_t lines);
+
+/**
+ * Check the text box updates on unchanged, changed and too long lines
+ * @return 0 if every check passed
+ */
+static int TFT_TestTextBoxes(void);
+
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+/**
+ * Fill the glyph cache, then draw characters that do not fit on screen
+ * @return 0 if the cache was left untouched
+ */
+static int TFT_TestGlyphCache(void);
+#endif
+
+int main(int argc, char **argv);
+
+//////////////////////////////////////////////////////////////////////
+/// Function definitions
+//////////////////////////////////////////////////////////////////////
+
+/* The display is the emulated controller behind TFT_ST7735_Write_SPI */
+void TFT_ST7735_Configure_SPI(void) {}
+void TFT_ST7735_Delay(unsigned int ms) { (void)ms; }
+void TFT_ST7735_Set_Chip_Select(TFT_ST7735_CS_T status) { (void)status; }
+void TFT_ST7735_Set_Data_Command(TFT_ST7735_Data_Command_T request) { TFT_testDc = request; }
+void TFT_ST7735_Set_Reset(TFT_ST7735_Reset_T status) { (void)status; }
+void TFT_ST7735_Wait_SPI(void) {}
+
+void TFT_ST7735_Write_SPI(unsigned char *data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        const uint8_t byte = data[i];
+
+        if (REQUEST_COMMAND == TFT_testDc)
+        {
+            TFT_testCommand = byte;
+            TFT_testParameter = 0;
+            TFT_testCommands++;
+            if (ST7735_RAMWR == byte)
+            {
+                TFT_testX = TFT_testColumn[0];
+                TFT_testY = TFT_testRow[0];
+            }
+            continue;
+        }
+
+        switch (TFT_testCommand)
+        {
+            case ST7735_CASET:
+            case ST7735_RASET:
+            {
+                /* Start then end, high byte first */
+                uint16_t* window = (ST7735_CASET == TFT_testCommand) ? &TFT_testColumn[0] : &TFT_testRow[0];
+                uint16_t* value = &window[(TFT_testParameter / 2U) & 1U];
+
+                *value = (TFT_testParameter & 1U) ? ((*value & 0xFF00U) | byte) : ((uint16_t)(byte << 8) | (*value & 0xFFU));
+                TFT_testParameter++;
+                break;
+            }
+            case ST7735_RAMWR:
+                if (0 == (TFT_testParameter & 1U))
+                {
+                    TFT_testHighByte = byte;
+                }
+                else
+                {
+                    if ((TFT_testX < TFT_TEST_RAM_SIZE) && (TFT_testY < TFT_TEST_RAM_SIZE))
+                    {
+                        TFT_testRam[TFT_testY][TFT_testX] = (uint16_t)(TFT_testHighByte << 8) | byte;
+                        TFT_testWritten[TFT_testY][TFT_testX] = 1;
+                    }
+                    TFT_testPixels++;
+
+                    TFT_testX++;
+                    if (TFT_testX > TFT_testColumn[1])
+                    {
+                        TFT_testX = TFT_testColumn[0];
+                        TFT_testY++;
+                    }
+                }
+                TFT_testParameter++;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static int TFT_TestFormat(int32_t value, uint8_t chars, uint8_t decimals, const char *expected)
+{
+    char str[TFT_NUMFIELD_CHARS + 8];
+    int64_t mag = (value < 0) ? -(int64_t)value : value;
+    int64_t max = 1;
+    int64_t shown = 0;
+    int room = chars - (decimals ? 1 : 0) - ((value < 0) ? 1 : 0);
+    int negative = 0;
+    int point = -1;
+    int failed = 0;
+
+    (void)memset(str, TFT_TEST_CANARY, sizeof(str));
+    TFT_ST7735_formatFixed(str, value, chars, decimals);
+
+    for (int i = 0; (i < room) && (i < 9); i++)
+    {
+        max *= 10;
+    }
+    if (mag > max - 1)
+    {
+        mag = max - 1;
+    }
+
+    /* Read it back: spaces, a sign, the digits with the point at its place */
+    for (int i = 0; i < chars; i++)
+    {
+        if (str[i] == '-')
+        {
+            negative = 1;
+        }
+        else if (str[i] == '.')
+        {
+            point = i;
+        }
+        else if ((str[i] >= '0') && (str[i] <= '9'))
+        {
+            shown = (shown * 10) + (str[i] - '0');
+        }
+        else if (str[i] != ' ')
+        {
+            failed = 1;
+        }
+    }
+
+    if ((str[chars] != 0) || (str[chars + 1] != TFT_TEST_CANARY))
+    {
+        failed = 1;
+    }
+    else if ((negative != (value < 0)) || (shown != mag))
+    {
+        failed = 1;
+    }
+    else if ((decimals > 0) && (point != chars - 1 - decimals))
+    {
+        failed = 1;
+    }
+    else if ((expected != 0) && (0 != strcmp(str, expected)))
+    {
+        failed = 1;
+    }
+
+    if (failed || (expected != 0))
+    {
+        str[chars + 1] = 0;
+        printf("%11ld in %2u chars, %2u decimals: \"%s\"%s\n",
+               (long)value, chars, decimals, str, failed ? " FAILED" : "");
+    }
+
+    return failed;
+}
+
+static int TFT_TestFormats(void)
+{
+    static const int32_t values[] =
+    {
+        0, 1, -1, 5, -5, 7, -7, 9, -9, 10, -10, 42, -42, 99, -99, 100, -100, 123, -123,
+        999, -999, 1000, -1000, 12345, -12345, 99999999, -99999999,
+        123456789, -123456789, 2147483647, -2147483647 - 1
+    };
+    TFT_ST7735_NumField_T field;
+    int failed = 0;
+
+    /* Overflowed the string before the point was given room */
+    failed |= TFT_TestFormat(5, 3, 1, "0.5");
+    failed |= TFT_TestFormat(5, 2, 0, " 5");
+    failed |= TFT_TestFormat(7, 12, 10, "0.0000000007");
+
+    /* Lost the sign when the leading zero did not fit */
+    failed |= TFT_TestFormat(-5, 4, 2, "-.05");
+    failed |= TFT_TestFormat(-123, 4, 2, "-.99");
+    failed |= TFT_TestFormat(-5, 3, 1, "-.5");
+    failed |= TFT_TestFormat(-123, 2, 0, "-9");
+    failed |= TFT_TestFormat(-5, 5, 2, "-0.05");
+    failed |= TFT_TestFormat(-5, 1, 0, "-");
+    failed |= TFT_TestFormat(123, 4, 2, "1.23");
+
+    for (uint8_t chars = 1; chars <= TFT_NUMFIELD_CHARS; chars++)
+    {
+        for (uint8_t decimals = 0; (decimals == 0) || (decimals + 2 <= chars); decimals++)
+        {
+            for (uint32_t v = 0; v < sizeof(values) / sizeof(values[0]); v++)
+            {
+                failed |= TFT_TestFormat(values[v], chars, decimals, 0);
+            }
+        }
+    }
+
+    /* The field keeps a leading digit and the point, whatever it is asked for */
+    for (uint8_t chars = 1; chars <= TFT_NUMFIELD_CHARS; chars++)
+    {
+        for (uint8_t decimals = 0; decimals <= TFT_NUMFIELD_CHARS; decimals++)
+        {
+            TFT_ST7735_initNumField(&field, 0, 0, chars, decimals, 2, TL_DATUM);
+            if ((field.decimals > 0) && (field.decimals + 2 > field.chars))
+            {
+                printf("initNumField(%u chars, %u decimals) kept %u decimals FAILED\n",
+                       chars, decimals, field.decimals);
+                failed = 1;
+            }
+            (void)TFT_ST7735_drawNumField(&field, 5);
+            (void)TFT_ST7735_drawNumField(&field, -2147483647 - 1);
+        }
+    }
+
+    printf("%s: formatFixed and numeric fields\n", failed ? "FAILED" : "passed");
+
+    return failed;
+}
+
+static void TFT_TestReset(uint8_t clear)
+{
+    if (clear)
+    {
+        for (uint32_t y = 0; y < TFT_TEST_RAM_SIZE; y++)
+        {
+            for (uint32_t x = 0; x < TFT_TEST_RAM_SIZE; x++)
+            {
+                TFT_testRam[y][x] = TFT_TEST_OFF;
+            }
+        }
+    }
+    (void)memset(TFT_testWritten, 0, sizeof(TFT_testWritten));
+    TFT_testCommands = 0;
+    TFT_testPixels = 0;
+}
+
+static int32_t TFT_TestDiffer(const uint16_t (*a)[TFT_TEST_RAM_SIZE], const uint16_t (*b)[TFT_TEST_RAM_SIZE], uint8_t written)
+{
+    int32_t differ = 0;
+    int exact = 1;
+
+    for (uint32_t y = 0; y < TFT_TEST_RAM_SIZE; y++)
+    {
+        for (uint32_t x = 0; x < TFT_TEST_RAM_SIZE; x++)
+        {
+            const int changed = (a[y][x] != b[y][x]);
+
+            differ += changed;
+            if (written && (changed != TFT_testWritten[y][x]))
+            {
+                exact = 0;
+            }
+        }
+    }
+
+    return exact ? differ : -1;
+}
+
+static int TFT_TestSevenSeg(void)
+{
+    static uint16_t eight[TFT_TEST_RAM_SIZE][TFT_TEST_RAM_SIZE];
+    static uint16_t three[TFT_TEST_RAM_SIZE][TFT_TEST_RAM_SIZE];
+    TFT_ST7735_SevenSeg_T display;
+    uint32_t firstPixels;
+    uint32_t firstCommands;
+    uint8_t repainted;
+    int32_t segments;
+    int32_t differ;
+    int failed = 0;
+
+    TFT_ST7735_init();
+    TFT_ST7735_setRotation(1);
+    TFT_ST7735_setTextColor_bgcolor(TFT_TEST_ON, TFT_TEST_OFF);
+
+    /* The two digits drawn from scratch */
+    TFT_TestReset(1);
+    TFT_ST7735_initSevenSeg(&display, TFT_TEST_SEG_X, TFT_TEST_SEG_Y, 1, 0, TL_DATUM);
+    (void)TFT_ST7735_drawSevenSeg(&display, 3);
+    (void)memcpy(three, TFT_testRam, sizeof(three));
+
+    TFT_TestReset(1);
+    TFT_ST7735_initSevenSeg(&display, TFT_TEST_SEG_X, TFT_TEST_SEG_Y, 1, 0, TL_DATUM);
+    (void)TFT_ST7735_drawSevenSeg(&display, 8);
+    (void)memcpy(eight, TFT_testRam, sizeof(eight));
+    firstPixels = TFT_testPixels;
+    firstCommands = TFT_testCommands;
+
+    /* 8 to 3 turns off E and F, those pixels and no others are sent */
+    TFT_TestReset(0);
+    repainted = TFT_ST7735_drawSevenSeg(&display, 3);
+    segments = TFT_TestDiffer((const uint16_t (*)[TFT_TEST_RAM_SIZE])eight, (const uint16_t (*)[TFT_TEST_RAM_SIZE])three, 1);
+    differ = TFT_TestDiffer((const uint16_t (*)[TFT_TEST_RAM_SIZE])TFT_testRam, (const uint16_t (*)[TFT_TEST_RAM_SIZE])three, 0);
+
+    printf("seven segment digit, size 1:\n");
+    printf("    first paint of 8           %5u pixels %4u command bytes\n", firstPixels, firstCommands);
+    printf("    8 to 3, %u segments         %5u pixels %4u command bytes\n", repainted, TFT_testPixels, TFT_testCommands);
+
+    if ((repainted != 2) || (segments <= 0) || ((uint32_t)segments != TFT_testPixels) || (differ != 0)
+        || (display.shown[0] != sevenseg_digit[3]))
+    {
+        printf("    the update is not exactly segments E and F (%d pixels differ, %d left wrong) FAILED\n",
+               (int)segments, (int)differ);
+        failed = 1;
+    }
+
+    /* The same change with the Font 7 glyph, drawn with its background */
+    TFT_TestReset(0);
+    (void)TFT_ST7735_drawChar_uniCode('3', TFT_TEST_SEG_X, TFT_TEST_SEG_Y, 7);
+    printf("    Font 7 glyph 3             %5u pixels %4u command bytes\n", TFT_testPixels, TFT_testCommands);
+
+    /* A negative value too long for its digits keeps its sign */
+    TFT_ST7735_initSevenSeg(&display, TFT_TEST_SEG_X, TFT_TEST_SEG_Y, 2, 1, TL_DATUM);
+    (void)TFT_ST7735_drawSevenSeg(&display, -5);
+    if ((display.shown[0] != 0x40) || (display.shown[1] != sevenseg_digit[5]))
+    {
+        printf("    -0.5 on 2 digits with 1 decimal is not \"-.5\" FAILED\n");
+        failed = 1;
+    }
+
+    printf("%s: seven segment updates\n", failed ? "FAILED" : "passed");
+
+    return failed;
+}
+
+static int TFT_TestTextBox(char *before, char *after, uint8_t lines)
+{
+    static uint16_t fresh[TFT_TEST_RAM_SIZE][TFT_TEST_RAM_SIZE];
+    TFT_ST7735_TextBox_T box;
+    uint8_t repainted;
+    int32_t differ;
+    int failed;
+
+    TFT_ST7735_setTextColor_bgcolor(TFT_TEST_ON, TFT_TEST_OFF);
+
+    TFT_TestReset(1);
+    TFT_ST7735_initTextBox(&box, 0, 0, TFT_TEST_BOX_W, TFT_TEST_BOX_H, TFT_TEST_BOX_FONT, TFT_ALIGN_LEFT, 1);
+    (void)TFT_ST7735_drawTextBox(&box, after, 0);
+    (void)memcpy(fresh, TFT_testRam, sizeof(fresh));
+
+    TFT_TestReset(1);
+    TFT_ST7735_initTextBox(&box, 0, 0, TFT_TEST_BOX_W, TFT_TEST_BOX_H, TFT_TEST_BOX_FONT, TFT_ALIGN_LEFT, 1);
+    (void)TFT_ST7735_drawTextBox(&box, before, 0);
+    TFT_TestReset(0);
+    repainted = TFT_ST7735_drawTextBox(&box, after, 1);
+    differ = TFT_TestDiffer((const uint16_t (*)[TFT_TEST_RAM_SIZE])TFT_testRam, (const uint16_t (*)[TFT_TEST_RAM_SIZE])fresh, 0);
+
+    failed = (repainted != lines) || (differ != 0);
+    printf("    %u lines, %5u pixels%s\n", repainted, TFT_testPixels, failed ? " FAILED" : "");
+
+    return failed;
+}
+
+static int TFT_TestTextBoxes(void)
+{
+    /* 20 two byte characters, more bytes than a line keeps */
+    char wide[] = "\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9"
+                  "\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\nend";
+    char text[] = "The quick brown fox\njumps over\nthe lazy dog";
+    char same[] = "The quick brown fox\njumps over\nthe lazy dog";
+    char cat[]  = "The quick brown fox\njumps over\nthe lazy cat";
+    char over[] = "The quick brown fox\njumps ovr\nthe lazy dog";
+    int failed = 0;
+
+    TFT_ST7735_init();
+    TFT_ST7735_setRotation(1);
+
+    printf("text box, font %u, redrawn with changedOnly:\n", TFT_TEST_BOX_FONT);
+    failed |= TFT_TestTextBox(text, same, 0);
+    failed |= TFT_TestTextBox(text, cat, 1);
+    failed |= TFT_TestTextBox(text, over, 1);
+    failed |= TFT_TestTextBox(wide, wide, 1);
+
+    printf("%s: text box updates\n", failed ? "FAILED" : "passed");
+
+    return failed;
+}
+
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+static int TFT_TestGlyphCache(void)
+{
+    static glyphentry entries[TFT_ST7735_GLYPH_CACHE_ENTRIES];
+    uint8_t count;
+    uint16_t used;
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t hitsAfter;
+    uint32_t missesAfter;
+    int failed = 0;
+
+    TFT_ST7735_init();
+    TFT_ST7735_setRotation(1);
+    TFT_ST7735_setTextColor_bgcolor(TFT_TEST_ON, TFT_TEST_OFF);
+    TFT_ST7735_glyphCacheFlush();
+
+    /* More Font 4 digits than the arena holds, so it is full and evicting */
+    for (char c = '0'; c <= '9'; c++)
+    {
+        (void)TFT_ST7735_drawChar_uniCode(c, 0, 0, 4);
+    }
+    count = glyph_count;
+    used = glyph_arena_used;
+    (void)memcpy(entries, glyph_entry, sizeof(entries));
+    TFT_ST7735_glyphCacheStats(&hits, &misses);
+
+    /* Not cached, then cached, each past the right and the bottom edge */
+    (void)TFT_ST7735_drawChar_uniCode('A', _width - 4, 0, 4);
+    (void)TFT_ST7735_drawChar_uniCode('A', 0, _height - 4, 4);
+    (void)TFT_ST7735_drawChar_uniCode('9', _width - 4, 0, 4);
+    (void)TFT_ST7735_drawChar_uniCode('9', -4, 0, 4);
+    TFT_ST7735_glyphCacheStats(&hitsAfter, &missesAfter);
+
+    if ((glyph_count != count) || (glyph_arena_used != used) || (hitsAfter != hits) || (missesAfter != misses)
+        || (0 != memcmp(entries, glyph_entry, sizeof(entries))))
+    {
+        printf("characters off screen changed the glyph cache FAILED\n");
+        failed = 1;
+    }
+
+    printf("%s: glyph cache, %u entries %u bytes\n", failed ? "FAILED" : "passed", count, used);
+
+    return failed;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    const char *test = (argc > 1) ? argv[1] : "format";
+
+    if (0 == strcmp(test, "format"))
+    {
+        return TFT_TestFormats();
+    }
+    if (0 == strcmp(test, "sevenseg"))
+    {
+        return TFT_TestSevenSeg();
+    }
+    if (0 == strcmp(test, "textbox"))
+    {
+        return TFT_TestTextBoxes();
+    }
+#ifdef TFT_ST7735_GLYPH_CACHE_BYTES
+    if (0 == strcmp(test, "glyphcache"))
+    {
+        return TFT_TestGlyphCache();
+    }
+#endif
+
+    fprintf(stderr, "usage: %s [format | sevenseg | textbox | glyphcache]\n", argv[0]);
+    return 2;
+}